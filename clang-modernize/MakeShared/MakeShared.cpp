@@ -0,0 +1,78 @@
+//===-- MakeShared/MakeShared.cpp - Use std::make_shared() ----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file provides the implementation of the MakeSharedTransform
+/// class.
+///
+//===----------------------------------------------------------------------===//
+
+#include "MakeShared.h"
+#include "MakeSharedActions.h"
+#include "MakeSharedMatchers.h"
+
+using namespace clang;
+using namespace clang::tooling;
+using namespace clang::ast_matchers;
+
+int MakeSharedTransform::apply(const CompilationDatabase &Database,
+                               const std::vector<std::string> &SourcePaths) {
+  ClangTool Tool(Database, SourcePaths);
+  unsigned AcceptedChanges = 0;
+  unsigned RejectedChanges = 0;
+  MatchFinder Finder;
+  SharedPtrNewReplacer Replacer(AcceptedChanges, RejectedChanges,
+                                /*Owner=*/ *this);
+
+  Finder.addMatcher(makeSharedPtrFromNewMatcher(), &Replacer);
+  Finder.addMatcher(makeSharedPtrResetMatcher(), &Replacer);
+
+  // make the replacer available to handleBeginSource()
+  this->Replacer = &Replacer;
+
+  if (Tool.run(createActionFactory(Finder))) {
+    llvm::errs() << "Error encountered during translation.\n";
+    return 1;
+  }
+
+  setAcceptedChanges(AcceptedChanges);
+  setRejectedChanges(RejectedChanges);
+  return 0;
+}
+
+bool MakeSharedTransform::handleBeginSource(CompilerInstance &CI,
+                                            llvm::StringRef Filename) {
+  assert(Replacer && "Replacer not set");
+  IncludeManager.reset(new IncludeDirectives(CI));
+  Replacer->setIncludeDirectives(IncludeManager.get());
+  return Transform::handleBeginSource(CI, Filename);
+}
+
+struct MakeSharedFactory : TransformFactory {
+  MakeSharedFactory() {
+    // std::make_shared() needs variadic templates and perfect forwarding.
+    Since.Clang = Version(3, 0);
+    Since.Gcc = Version(4, 6);
+    Since.Icc = Version(13);
+    Since.Msvc = Version(11);
+  }
+
+  Transform *createTransform(const TransformOptions &Opts) override {
+    return new MakeSharedTransform(Opts);
+  }
+};
+
+// Register the factory using this statically initialized variable.
+static TransformFactoryRegistry::Add<MakeSharedFactory>
+X("make-shared", "Replace std::shared_ptr construction from new-expressions by "
+                 "std::make_shared()");
+
+// This anchor is used to force the linker to link in the generated object file
+// and thus register the factory.
+volatile int MakeSharedTransformAnchorSource = 0;
@@ -0,0 +1,59 @@
+//===-- MakeShared/MakeShared.h - Use std::make_shared() --------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file provides the declaration of the MakeSharedTransform
+/// class.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_MAKE_SHARED_H
+#define CLANG_MODERNIZE_MAKE_SHARED_H
+
+#include "Core/IncludeDirectives.h"
+#include "Core/Transform.h"
+
+class SharedPtrNewReplacer;
+
+/// \brief Subclass of Transform that replaces the construction of a
+/// \c std::shared_ptr from a new-expression by a call to
+/// \c std::make_shared().
+///
+/// \c std::make_shared() allocates the object and the reference counts with a
+/// single allocation instead of two.
+///
+/// For example, given:
+/// \code
+///   std::shared_ptr<Foo> a = std::shared_ptr<Foo>(new Foo(1, 2));
+///   a.reset(new Foo(3, 4));
+/// \endcode
+/// the code is transformed to:
+/// \code
+///   std::shared_ptr<Foo> a = std::make_shared<Foo>(1, 2);
+///   a = std::make_shared<Foo>(3, 4);
+/// \endcode
+class MakeSharedTransform : public Transform {
+public:
+  MakeSharedTransform(const TransformOptions &Options)
+      : Transform("MakeShared", Options), Replacer(nullptr) {}
+
+  /// \see Transform::apply().
+  virtual int apply(const clang::tooling::CompilationDatabase &Database,
+                    const std::vector<std::string> &SourcePaths) override;
+
+private:
+  /// \brief Setups the \c IncludeDirectives for the replacer.
+  virtual bool handleBeginSource(clang::CompilerInstance &CI,
+                                 llvm::StringRef Filename) override;
+
+  std::unique_ptr<IncludeDirectives> IncludeManager;
+  SharedPtrNewReplacer *Replacer;
+};
+
+#endif // CLANG_MODERNIZE_MAKE_SHARED_H
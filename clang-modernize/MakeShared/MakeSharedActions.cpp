@@ -0,0 +1,209 @@
+//===-- MakeShared/MakeSharedActions.cpp - Use std::make_shared() ---------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the definition of the ASTMatcher callback for the
+/// MakeShared transform.
+///
+//===----------------------------------------------------------------------===//
+
+#include "MakeSharedActions.h"
+#include "Core/IncludeDirectives.h"
+#include "Core/Transform.h"
+#include "MakeSharedMatchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang;
+using namespace clang::tooling;
+using namespace clang::ast_matchers;
+
+namespace {
+
+/// \brief Returns the type managed by the \c std::shared_ptr type \p Type.
+QualType getPointeeType(QualType Type) {
+  const ClassTemplateSpecializationDecl *Spec =
+      dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+          Type->getAsCXXRecordDecl());
+  if (!Spec || Spec->getTemplateArgs().size() < 1 ||
+      Spec->getTemplateArgs()[0].getKind() != TemplateArgument::Type)
+    return QualType();
+  return Spec->getTemplateArgs()[0].getAsType();
+}
+
+/// \brief Strips the implicit nodes wrapping the constructor call of a
+/// functional cast.
+const Expr *ignoreTemporaryWrappers(const Expr *E) {
+  while (true) {
+    if (const ImplicitCastExpr *Cast = dyn_cast<ImplicitCastExpr>(E))
+      E = Cast->getSubExpr();
+    else if (const CXXBindTemporaryExpr *Bind =
+                 dyn_cast<CXXBindTemporaryExpr>(E))
+      E = Bind->getSubExpr();
+    else
+      return E;
+  }
+}
+
+/// \brief Whether the initializer argument \p Arg would still select the same
+/// constructor after being forwarded through \c std::make_shared().
+bool isForwardable(const Expr *Arg) {
+  if (const ImplicitCastExpr *Cast = dyn_cast<ImplicitCastExpr>(Arg)) {
+    if (Cast->getCastKind() == CK_NullToPointer ||
+        Cast->getCastKind() == CK_NullToMemberPointer ||
+        Cast->getCastKind() == CK_FunctionToPointerDecay)
+      return false;
+  }
+  const Expr *E = Arg->IgnoreParenImpCasts();
+  return !isa<InitListExpr>(E) && !isa<CXXStdInitializerListExpr>(E) &&
+         !E->refersToBitField() && !E->getType()->isNullPtrType();
+}
+
+} // end anonymous namespace
+
+std::string
+SharedPtrNewReplacer::getMakeSharedCall(const CXXNewExpr *New,
+                                        QualType PointeeType,
+                                        const SourceManager &SM) {
+  if (PointeeType.isNull() || New->isArray() ||
+      New->getNumPlacementArgs() != 0 ||
+      New->getInitializationStyle() == CXXNewExpr::ListInit ||
+      New->getStartLoc().isMacroID())
+    return std::string();
+
+  // std::make_shared() ignores a class-specific operator new.
+  if (isa<CXXMethodDecl>(New->getOperatorNew()))
+    return std::string();
+
+  // Constructing a derived class would change the type of the expression.
+  if (New->getAllocatedType().getCanonicalType() !=
+      PointeeType.getCanonicalType())
+    return std::string();
+
+  // std::make_shared() can't call a non-public constructor.
+  if (const CXXConstructExpr *Construct = New->getConstructExpr()) {
+    if (Construct->getConstructor()->getAccess() != AS_public)
+      return std::string();
+    for (unsigned I = 0, E = Construct->getNumArgs(); I != E; ++I)
+      if (!isForwardable(Construct->getArg(I)))
+        return std::string();
+  } else if (const Expr *Init = New->getInitializer()) {
+    if (!isForwardable(Init))
+      return std::string();
+  }
+
+  const TypeSourceInfo *TSI = New->getAllocatedTypeSourceInfo();
+  if (!TSI)
+    return std::string();
+  StringRef TypeStr = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(TSI->getTypeLoc().getSourceRange()), SM,
+      LangOptions());
+  if (TypeStr.empty())
+    return std::string();
+
+  // The arguments are spelled between the parentheses of 'new T(...)'.
+  StringRef ArgsStr;
+  if (New->getInitializationStyle() == CXXNewExpr::CallInit) {
+    SourceRange Parens = New->getDirectInitRange();
+    if (Parens.getBegin().isMacroID() || Parens.getEnd().isMacroID())
+      return std::string();
+    ArgsStr = Lexer::getSourceText(
+        CharSourceRange::getCharRange(
+            Parens.getBegin().getLocWithOffset(1), Parens.getEnd()),
+        SM, LangOptions());
+  }
+
+  return ("std::make_shared<" + TypeStr + ">(" + ArgsStr + ")").str();
+}
+
+void SharedPtrNewReplacer::run(const MatchFinder::MatchResult &Result) {
+  SourceManager &SM = *Result.SourceManager;
+  const CXXNewExpr *New = nullptr;
+  QualType PointeeType;
+  CharSourceRange ReplacedRange;
+  std::string Prefix;
+  SourceLocation DerefLoc;
+
+  if (const CXXFunctionalCastExpr *Cast =
+          Result.Nodes.getNodeAs<CXXFunctionalCastExpr>(SharedPtrConstructId)) {
+    // 'std::shared_ptr<T>(new T(args))' -> 'std::make_shared<T>(args)'
+    const CXXConstructExpr *Construct = dyn_cast<CXXConstructExpr>(
+        ignoreTemporaryWrappers(Cast->getSubExpr()));
+    if (!Construct || Construct->getNumArgs() != 1)
+      return;
+    New = dyn_cast<CXXNewExpr>(Construct->getArg(0)->IgnoreParenImpCasts());
+    PointeeType = getPointeeType(Cast->getType());
+    ReplacedRange = CharSourceRange::getTokenRange(Cast->getSourceRange());
+  } else {
+    // 'p.reset(new T(args))' -> 'p = std::make_shared<T>(args)'
+    const CXXMemberCallExpr *Reset =
+        Result.Nodes.getNodeAs<CXXMemberCallExpr>(SharedPtrResetId);
+    assert(Reset && "Bad Callback. No node provided.");
+    const MemberExpr *Callee = dyn_cast<MemberExpr>(Reset->getCallee());
+    if (!Callee || Callee->isImplicitAccess())
+      return;
+    // The assignment returns a reference instead of void, only replace calls
+    // whose result is discarded.
+    auto Parents = Result.Context->getParents(*Reset);
+    if (Parents.empty() || !Parents[0].get<Stmt>() ||
+        isa<Expr>(Parents[0].get<Stmt>()))
+      return;
+    New = Result.Nodes.getNodeAs<CXXNewExpr>(NewExprId);
+    PointeeType = getPointeeType(Callee->getBase()->getType()->isPointerType()
+                                     ? Callee->getBase()->getType()
+                                           ->getPointeeType()
+                                     : Callee->getBase()->getType());
+    ReplacedRange = CharSourceRange::getTokenRange(Callee->getOperatorLoc(),
+                                                   Reset->getLocEnd());
+    Prefix = " = ";
+    // 'p->reset(...)' -> '*p = ...'
+    if (Callee->isArrow()) {
+      DerefLoc = Callee->getBase()->getLocStart();
+      if (DerefLoc.isMacroID())
+        return;
+    }
+  }
+
+  if (!New)
+    return;
+  std::string MakeShared = getMakeSharedCall(New, PointeeType, SM);
+  if (MakeShared.empty())
+    return;
+
+  SourceLocation Begin = ReplacedRange.getBegin();
+  if (Begin.isMacroID() || ReplacedRange.getEnd().isMacroID() ||
+      !Owner.isFileModifiable(SM, Begin))
+    return;
+
+  // Reject the changes if the risk level is not acceptable: the memory of the
+  // object is now only released when the last weak_ptr to it goes away.
+  if (!Owner.isAcceptableRiskLevel(RL_Reasonable)) {
+    RejectedChanges++;
+    return;
+  }
+
+  // if needed, include <memory> in the file that uses std::make_shared()
+  const FileEntry *MakeSharedFile = SM.getFileEntryForID(SM.getFileID(Begin));
+  const tooling::Replacement &IncludeReplace =
+      IncludeManager->addAngledInclude(MakeSharedFile, "memory");
+  if (IncludeReplace.isApplicable()) {
+    Owner.addReplacementForCurrentTU(IncludeReplace);
+    AcceptedChanges++;
+  }
+
+  if (DerefLoc.isValid()) {
+    Owner.addReplacementForCurrentTU(Replacement(SM, DerefLoc, 0, "*"));
+    AcceptedChanges++;
+  }
+  Owner.addReplacementForCurrentTU(
+      Replacement(SM, ReplacedRange, Prefix + MakeShared));
+  AcceptedChanges++;
+}
@@ -0,0 +1,80 @@
+//===-- MakeShared/MakeSharedActions.h - Use std::make_shared() -*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the declaration of the ASTMatcher callback for the
+/// MakeShared transform.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_MAKE_SHARED_ACTIONS_H
+#define CLANG_MODERNIZE_MAKE_SHARED_ACTIONS_H
+
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Tooling/Refactoring.h"
+
+class Transform;
+class IncludeDirectives;
+
+/// \brief Callback that replaces the construction of a \c std::shared_ptr from
+/// a new-expression by a call to \c std::make_shared().
+///
+/// Modifications done by the callback:
+/// - \#include \<memory\> is added if necessary for the declaration of
+///   \c std::make_shared() to be available.
+/// - The construction or the call to \c reset() is replaced.
+///
+/// Example:
+/// \code
+/// + #include <memory>
+///
+/// - std::shared_ptr<Foo> p = std::shared_ptr<Foo>(new Foo(1, 2));
+/// + std::shared_ptr<Foo> p = std::make_shared<Foo>(1, 2);
+/// - p.reset(new Foo(3, 4));
+/// + p = std::make_shared<Foo>(3, 4);
+/// \endcode
+///
+/// Nothing is changed when a custom deleter is given, when the new-expression
+/// allocates an array, uses placement arguments or a class-specific
+/// \c operator \c new, or constructs another type than the pointee type, or
+/// when the constructor isn't public.
+///
+/// \note Since an include may be added by this matcher it's necessary to call
+/// \c setIncludeDirectives() with an up-to-date \c IncludeDirectives. This is
+/// typically done by overloading \c Transform::handleBeginSource().
+class SharedPtrNewReplacer
+    : public clang::ast_matchers::MatchFinder::MatchCallback {
+public:
+  SharedPtrNewReplacer(unsigned &AcceptedChanges, unsigned &RejectedChanges,
+                       Transform &Owner)
+      : AcceptedChanges(AcceptedChanges), RejectedChanges(RejectedChanges),
+        Owner(Owner), IncludeManager(nullptr) {}
+
+  void setIncludeDirectives(IncludeDirectives *Includes) {
+    IncludeManager = Includes;
+  }
+
+private:
+  /// \brief Entry point to the callback called when matches are made.
+  virtual void run(const clang::ast_matchers::MatchFinder::MatchResult &Result)
+      override;
+
+  /// \brief Returns the 'std::make_shared<T>(args)' call equivalent to \p New,
+  /// or an empty string if there is none.
+  std::string getMakeSharedCall(const clang::CXXNewExpr *New,
+                                clang::QualType PointeeType,
+                                const clang::SourceManager &SM);
+
+  unsigned &AcceptedChanges;
+  unsigned &RejectedChanges;
+  Transform &Owner;
+  IncludeDirectives *IncludeManager;
+};
+
+#endif // CLANG_MODERNIZE_MAKE_SHARED_ACTIONS_H
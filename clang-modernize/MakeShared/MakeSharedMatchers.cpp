@@ -0,0 +1,44 @@
+//===-- MakeShared/MakeSharedMatchers.cpp - Use std::make_shared() --------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the definitions for matcher-generating functions
+/// and names for bound nodes found by AST matchers.
+///
+//===----------------------------------------------------------------------===//
+
+#include "MakeSharedMatchers.h"
+#include "Core/CustomMatchers.h"
+
+using namespace clang::ast_matchers;
+using namespace clang;
+
+const char *SharedPtrConstructId = "SharedPtrConstruct";
+const char *SharedPtrResetId = "SharedPtrReset";
+const char *NewExprId = "NewExpr";
+
+// shared matchers
+static DeclarationMatcher SharedPtrDecl =
+    recordDecl(hasName("shared_ptr"), isFromStdNamespace());
+
+StatementMatcher makeSharedPtrFromNewMatcher() {
+  // 'std::shared_ptr<T>(new T)' is a functional cast wrapping the constructor
+  // call, the new-expression is looked up by the callback.
+  return functionalCastExpr(
+             hasDestinationType(qualType(hasDeclaration(SharedPtrDecl))))
+      .bind(SharedPtrConstructId);
+}
+
+StatementMatcher makeSharedPtrResetMatcher() {
+  return memberCallExpr(callee(methodDecl(hasName("reset"),
+                                          ofClass(SharedPtrDecl))),
+                        argumentCountIs(1),
+                        hasArgument(0, newExpr().bind(NewExprId)))
+      .bind(SharedPtrResetId);
+}
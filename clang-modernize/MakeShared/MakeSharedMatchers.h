@@ -0,0 +1,49 @@
+//===-- MakeShared/MakeSharedMatchers.h - Use std::make_shared() *- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the declarations for matcher-generating functions
+/// and names for bound nodes found by AST matchers.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_MAKE_SHARED_MATCHERS_H
+#define CLANG_MODERNIZE_MAKE_SHARED_MATCHERS_H
+
+#include "clang/ASTMatchers/ASTMatchers.h"
+
+/// Names to bind with matched expressions.
+extern const char *SharedPtrConstructId;
+extern const char *SharedPtrResetId;
+extern const char *NewExprId;
+
+/// \brief Creates a matcher that finds the functional casts to
+/// \c std::shared_ptr, i.e. explicit constructions from a single argument.
+///
+/// \c SharedPtrConstructId is bound to the cast.
+///
+/// \code
+///   std::shared_ptr<Foo>(new Foo(1, 2))
+///   ^~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// \endcode
+clang::ast_matchers::StatementMatcher makeSharedPtrFromNewMatcher();
+
+/// \brief Creates a matcher that finds the calls to \c std::shared_ptr::reset()
+/// with a single new-expression.
+///
+/// \c SharedPtrResetId is bound to the call, \c NewExprId to the
+/// new-expression.
+///
+/// \code
+///   p.reset(new Foo(1, 2))
+///   ^~~~~~~~~~~~~~~~~~~~~~
+/// \endcode
+clang::ast_matchers::StatementMatcher makeSharedPtrResetMatcher();
+
+#endif // CLANG_MODERNIZE_MAKE_SHARED_MATCHERS_H
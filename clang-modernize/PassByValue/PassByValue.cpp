@@ -27,10 +27,11 @@ int PassByValueTransform::apply(const tooling::CompilationDatabase &Database,
   unsigned AcceptedChanges = 0;
   unsigned RejectedChanges = 0;
   MatchFinder Finder;
-  ConstructorParamReplacer Replacer(AcceptedChanges, RejectedChanges,
-                                    /*Owner=*/ *this);
+  CopiedParamReplacer Replacer(AcceptedChanges, RejectedChanges,
+                               /*Owner=*/ *this);
 
   Finder.addMatcher(makePassByValueCtorParamMatcher(), &Replacer);
+  Finder.addMatcher(makePassByValueSetterParamMatcher(), &Replacer);
 
   // make the replacer available to handleBeginSource()
   this->Replacer = &Replacer;
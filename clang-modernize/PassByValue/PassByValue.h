@@ -19,13 +19,13 @@
 #include "Core/IncludeDirectives.h"
 #include "Core/Transform.h"
 
-class ConstructorParamReplacer;
+class CopiedParamReplacer;
 
 /// \brief Subclass of Transform that uses pass-by-value semantic when move
 /// constructors are available to avoid copies.
 ///
-/// When a class constructor accepts an object by const reference with the
-/// intention of copying the object the copy can be avoided in certain
+/// When a class constructor, or a setter, accepts an object by const reference
+/// with the intention of copying the object the copy can be avoided in certain
 /// situations if the object has a move constructor. First, the constructor is
 /// changed to accept the object by value instead. Then this argument is moved
 /// instead of copied into class-local storage. If an l-value is provided to the
@@ -67,7 +67,7 @@ private:
                                  llvm::StringRef Filename) override;
 
   std::unique_ptr<IncludeDirectives> IncludeManager;
-  ConstructorParamReplacer *Replacer;
+  CopiedParamReplacer *Replacer;
 };
 
 #endif // CLANG_MODERNIZE_PASS_BY_VALUE_H
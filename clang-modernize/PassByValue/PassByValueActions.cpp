@@ -38,10 +38,10 @@ public:
   ExactlyOneUsageVisitor(const ParmVarDecl *ParamDecl) : ParamDecl(ParamDecl) {}
 
   /// \brief Whether or not the parameter variable is referred only once in the
-  /// given constructor.
-  bool hasExactlyOneUsageIn(const CXXConstructorDecl *Ctor) {
+  /// given function.
+  bool hasExactlyOneUsageIn(const FunctionDecl *Function) {
     Count = 0;
-    TraverseDecl(const_cast<CXXConstructorDecl *>(Ctor));
+    TraverseDecl(const_cast<FunctionDecl *>(Function));
     return Count == 1;
   }
 
@@ -65,55 +65,66 @@ private:
 };
 } // end anonymous namespace
 
-/// \brief Whether or not \p ParamDecl is used exactly one time in \p Ctor.
+/// \brief Whether or not \p ParamDecl is used exactly one time in
+/// \p Function.
 ///
-/// Checks both in the init-list and the body of the constructor.
-static bool paramReferredExactlyOnce(const CXXConstructorDecl *Ctor,
+/// For constructors, checks both in the init-list and the body.
+static bool paramReferredExactlyOnce(const FunctionDecl *Function,
                                      const ParmVarDecl *ParamDecl) {
   ExactlyOneUsageVisitor Visitor(ParamDecl);
-  return Visitor.hasExactlyOneUsageIn(Ctor);
+  return Visitor.hasExactlyOneUsageIn(Function);
 }
 
 /// \brief Find all references to \p ParamDecl across all of the
-/// redeclarations of \p Ctor.
+/// redeclarations of \p Function.
 static void
-collectParamDecls(const CXXConstructorDecl *Ctor, const ParmVarDecl *ParamDecl,
+collectParamDecls(const FunctionDecl *Function, const ParmVarDecl *ParamDecl,
                   llvm::SmallVectorImpl<const ParmVarDecl *> &Results) {
   unsigned ParamIdx = ParamDecl->getFunctionScopeIndex();
 
-  for (CXXConstructorDecl::redecl_iterator I = Ctor->redecls_begin(),
-                                           E = Ctor->redecls_end();
+  for (FunctionDecl::redecl_iterator I = Function->redecls_begin(),
+                                     E = Function->redecls_end();
        I != E; ++I)
     Results.push_back((*I)->getParamDecl(ParamIdx));
 }
 
-void ConstructorParamReplacer::run(const MatchFinder::MatchResult &Result) {
-  assert(IncludeManager && "Include directives manager not set.");
-  SourceManager &SM = *Result.SourceManager;
-  const CXXConstructorDecl *Ctor =
-      Result.Nodes.getNodeAs<CXXConstructorDecl>(PassByValueCtorId);
-  const ParmVarDecl *ParamDecl =
-      Result.Nodes.getNodeAs<ParmVarDecl>(PassByValueParamId);
-  const CXXCtorInitializer *Initializer =
-      Result.Nodes.getNodeAs<CXXCtorInitializer>(PassByValueInitializerId);
-  assert(Ctor && ParamDecl && Initializer && "Bad Callback, missing node.");
-
-  // Check this now to avoid unnecessary work. The param locations are checked
-  // later.
-  if (!Owner.isFileModifiable(SM, Initializer->getSourceLocation()))
-    return;
-
-  // The parameter will be in an unspecified state after the move, so check if
-  // the parameter is used for anything else other than the copy. If so do not
-  // apply any changes.
-  if (!paramReferredExactlyOnce(Ctor, ParamDecl))
-    return;
+/// \brief Whether the class of \p Method has an overload of it taking an
+/// rvalue reference in place of \p ParamDecl.
+///
+/// With 'setX(const T &)' and 'setX(T &&)', changing the former to 'setX(T)'
+/// makes the calls with an rvalue ambiguous.
+static bool hasRValueReferenceOverload(const CXXMethodDecl *Method,
+                                       const ParmVarDecl *ParamDecl) {
+  unsigned ParamIdx = ParamDecl->getFunctionScopeIndex();
+  DeclContext::lookup_const_result Overloads =
+      Method->getParent()->lookup(Method->getDeclName());
+  for (DeclContext::lookup_const_iterator I = Overloads.begin(),
+                                          E = Overloads.end();
+       I != E; ++I) {
+    const CXXMethodDecl *Overload = dyn_cast<CXXMethodDecl>(*I);
+    if (!Overload ||
+        Overload->getCanonicalDecl() == Method->getCanonicalDecl() ||
+        ParamIdx >= Overload->getNumParams())
+      continue;
+    if (Overload->getParamDecl(ParamIdx)->getType()->isRValueReferenceType())
+      return true;
+  }
+  return false;
+}
 
+/// \brief Generates the replacements changing \p ParamDecl to a value on all
+/// of the redeclarations of \p Function.
+///
+/// \returns false if one of the parameters can't be changed, in which case
+/// none of them should be.
+static bool
+makeParamReplacements(const FunctionDecl *Function,
+                      const ParmVarDecl *ParamDecl, const SourceManager &SM,
+                      Transform &Owner,
+                      llvm::SmallVectorImpl<Replacement> &ParamReplaces) {
   llvm::SmallVector<const ParmVarDecl *, 2> AllParamDecls;
-  collectParamDecls(Ctor, ParamDecl, AllParamDecls);
+  collectParamDecls(Function, ParamDecl, AllParamDecls);
 
-  // Generate all replacements for the params.
-  llvm::SmallVector<Replacement, 2> ParamReplaces;
   for (unsigned I = 0, E = AllParamDecls.size(); I != E; ++I) {
     TypeLoc ParamTL = AllParamDecls[I]->getTypeSourceInfo()->getTypeLoc();
     ReferenceTypeLoc RefTL = ParamTL.getAs<ReferenceTypeLoc>();
@@ -132,26 +143,24 @@ void ConstructorParamReplacer::run(const MatchFinder::MatchResult &Result) {
         LangOptions());
 
     // If it's impossible to change one of the parameter (e.g: comes from an
-    // unmodifiable header) quit the callback now, do not generate any changes.
+    // unmodifiable header) quit now, do not generate any changes.
     if (CharRange.isInvalid() || ValueStr.empty() ||
         !Owner.isFileModifiable(SM, CharRange.getBegin()))
-      return;
+      return false;
 
     // 'const Foo &param' -> 'Foo param'
     //  ~~~~~~~~~~~           ~~~^
     ValueStr += ' ';
     ParamReplaces.push_back(Replacement(SM, CharRange, ValueStr));
   }
+  return true;
+}
 
-  // Reject the changes if the the risk level is not acceptable.
-  if (!Owner.isAcceptableRiskLevel(RL_Reasonable)) {
-    RejectedChanges++;
-    return;
-  }
-
+void CopiedParamReplacer::addParamReplacements(
+    const SourceManager &SM, SourceLocation MoveLoc,
+    llvm::ArrayRef<Replacement> ParamReplaces) {
   // if needed, include <utility> in the file that uses std::move()
-  const FileEntry *STDMoveFile =
-      SM.getFileEntryForID(SM.getFileID(Initializer->getLParenLoc()));
+  const FileEntry *STDMoveFile = SM.getFileEntryForID(SM.getFileID(MoveLoc));
   const tooling::Replacement &IncludeReplace =
       IncludeManager->addAngledInclude(STDMoveFile, "utility");
   if (IncludeReplace.isApplicable()) {
@@ -165,6 +174,50 @@ void ConstructorParamReplacer::run(const MatchFinder::MatchResult &Result) {
     Owner.addReplacementForCurrentTU(*I);
   }
   AcceptedChanges += ParamReplaces.size();
+}
+
+void CopiedParamReplacer::run(const MatchFinder::MatchResult &Result) {
+  assert(IncludeManager && "Include directives manager not set.");
+  if (Result.Nodes.getNodeAs<CXXCtorInitializer>(PassByValueInitializerId))
+    replaceInitializerCopy(Result);
+  else
+    replaceAssignmentCopy(Result);
+}
+
+void CopiedParamReplacer::replaceInitializerCopy(
+    const MatchFinder::MatchResult &Result) {
+  SourceManager &SM = *Result.SourceManager;
+  const CXXConstructorDecl *Ctor =
+      Result.Nodes.getNodeAs<CXXConstructorDecl>(PassByValueCtorId);
+  const ParmVarDecl *ParamDecl =
+      Result.Nodes.getNodeAs<ParmVarDecl>(PassByValueParamId);
+  const CXXCtorInitializer *Initializer =
+      Result.Nodes.getNodeAs<CXXCtorInitializer>(PassByValueInitializerId);
+  assert(Ctor && ParamDecl && Initializer && "Bad Callback, missing node.");
+
+  // Check this now to avoid unnecessary work. The param locations are checked
+  // later.
+  if (!Owner.isFileModifiable(SM, Initializer->getSourceLocation()))
+    return;
+
+  // The parameter will be in an unspecified state after the move, so check if
+  // the parameter is used for anything else other than the copy. If so do not
+  // apply any changes.
+  if (!paramReferredExactlyOnce(Ctor, ParamDecl))
+    return;
+
+  // Generate all replacements for the params.
+  llvm::SmallVector<Replacement, 2> ParamReplaces;
+  if (!makeParamReplacements(Ctor, ParamDecl, SM, Owner, ParamReplaces))
+    return;
+
+  // Reject the changes if the the risk level is not acceptable.
+  if (!Owner.isAcceptableRiskLevel(RL_Reasonable)) {
+    RejectedChanges++;
+    return;
+  }
+
+  addParamReplacements(SM, Initializer->getLParenLoc(), ParamReplaces);
 
   // move the value in the init-list
   Owner.addReplacementForCurrentTU(Replacement(
@@ -173,3 +226,51 @@ void ConstructorParamReplacer::run(const MatchFinder::MatchResult &Result) {
       Replacement(SM, Initializer->getRParenLoc(), 0, ")"));
   AcceptedChanges += 2;
 }
+
+void CopiedParamReplacer::replaceAssignmentCopy(
+    const MatchFinder::MatchResult &Result) {
+  SourceManager &SM = *Result.SourceManager;
+  const CXXMethodDecl *Method =
+      Result.Nodes.getNodeAs<CXXMethodDecl>(PassByValueMethodId);
+  const ParmVarDecl *ParamDecl =
+      Result.Nodes.getNodeAs<ParmVarDecl>(PassByValueParamId);
+  const CXXOperatorCallExpr *Assignment =
+      Result.Nodes.getNodeAs<CXXOperatorCallExpr>(PassByValueAssignmentId);
+  assert(Method && ParamDecl && Assignment && "Bad Callback, missing node.");
+
+  // The signature of virtual functions must match the one of the overridden
+  // and overriding functions. Template instantiations are changed through
+  // their pattern.
+  if (Method->isVirtual() || Method->isTemplateInstantiation() ||
+      hasRValueReferenceOverload(Method, ParamDecl))
+    return;
+
+  const Expr *ParamRef = Assignment->getArg(1)->IgnoreParenImpCasts();
+  SourceLocation RefBegin = ParamRef->getLocStart();
+  SourceLocation RefEnd =
+      Lexer::getLocForEndOfToken(ParamRef->getLocEnd(), 0, SM, LangOptions());
+  if (RefBegin.isMacroID() || RefEnd.isInvalid() ||
+      !Owner.isFileModifiable(SM, RefBegin))
+    return;
+
+  // As for constructors, the moved-from parameter mustn't be used again.
+  if (!paramReferredExactlyOnce(Method, ParamDecl))
+    return;
+
+  llvm::SmallVector<Replacement, 2> ParamReplaces;
+  if (!makeParamReplacements(Method, ParamDecl, SM, Owner, ParamReplaces))
+    return;
+
+  // Reject the changes if the the risk level is not acceptable.
+  if (!Owner.isAcceptableRiskLevel(RL_Reasonable)) {
+    RejectedChanges++;
+    return;
+  }
+
+  addParamReplacements(SM, RefBegin, ParamReplaces);
+
+  // 'Field = Param' -> 'Field = std::move(Param)'
+  Owner.addReplacementForCurrentTU(Replacement(SM, RefBegin, 0, "std::move("));
+  Owner.addReplacementForCurrentTU(Replacement(SM, RefEnd, 0, ")"));
+  AcceptedChanges += 2;
+}
@@ -18,18 +18,20 @@
 
 #include "clang/ASTMatchers/ASTMatchFinder.h"
 #include "clang/Tooling/Refactoring.h"
+#include "llvm/ADT/ArrayRef.h"
 
 class Transform;
 class IncludeDirectives;
 
-/// \brief Callback that replaces const-ref parameters in constructors to use
-/// pass-by-value semantic where applicable.
+/// \brief Callback that replaces const-ref parameters in constructors and
+/// setters to use pass-by-value semantic where applicable.
 ///
 /// Modifications done by the callback:
 /// - \#include \<utility\> is added if necessary for the definition of
 ///   \c std::move() to be available.
 /// - The parameter type is changed from const-ref to value-type.
-/// - In the init-list the parameter is moved.
+/// - In the init-list, or in the assignment to the field, the parameter is
+///   moved.
 ///
 /// Example:
 /// \code
@@ -40,6 +42,9 @@ class IncludeDirectives;
 ///   - Foo(const std::string &S) : S(S) {}
 ///   + Foo(std::string S) : S(std::move(S)) {}
 ///
+///   - void setS(const std::string &NewS) { S = NewS; }
+///   + void setS(std::string NewS) { S = std::move(NewS); }
+///
 /// private:
 ///   std::string S;
 /// };
@@ -48,11 +53,11 @@ class IncludeDirectives;
 /// \note Since an include may be added by this matcher it's necessary to call
 /// \c setIncludeDirectives() with an up-to-date \c IncludeDirectives. This is
 /// typically done by overloading \c Transform::handleBeginSource().
-class ConstructorParamReplacer
+class CopiedParamReplacer
     : public clang::ast_matchers::MatchFinder::MatchCallback {
 public:
-  ConstructorParamReplacer(unsigned &AcceptedChanges, unsigned &RejectedChanges,
-                           Transform &Owner)
+  CopiedParamReplacer(unsigned &AcceptedChanges, unsigned &RejectedChanges,
+                      Transform &Owner)
       : AcceptedChanges(AcceptedChanges), RejectedChanges(RejectedChanges),
         Owner(Owner), IncludeManager(nullptr) {}
 
@@ -65,6 +70,20 @@ private:
   virtual void run(const clang::ast_matchers::MatchFinder::MatchResult &Result)
       override;
 
+  /// \brief Handles the matches of \c makePassByValueCtorParamMatcher().
+  void replaceInitializerCopy(
+      const clang::ast_matchers::MatchFinder::MatchResult &Result);
+
+  /// \brief Handles the matches of \c makePassByValueSetterParamMatcher().
+  void replaceAssignmentCopy(
+      const clang::ast_matchers::MatchFinder::MatchResult &Result);
+
+  /// \brief Adds the parameter replacements and, if needed, the \<utility\>
+  /// include to the file containing \p MoveLoc.
+  void addParamReplacements(
+      const clang::SourceManager &SM, clang::SourceLocation MoveLoc,
+      llvm::ArrayRef<clang::tooling::Replacement> ParamReplaces);
+
   unsigned &AcceptedChanges;
   unsigned &RejectedChanges;
   Transform &Owner;
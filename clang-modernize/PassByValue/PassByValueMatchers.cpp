@@ -18,6 +18,8 @@
 const char *PassByValueCtorId = "Ctor";
 const char *PassByValueParamId = "Param";
 const char *PassByValueInitializerId = "Initializer";
+const char *PassByValueMethodId = "Method";
+const char *PassByValueAssignmentId = "Assignment";
 
 namespace clang {
 namespace ast_matchers {
@@ -57,6 +59,43 @@ AST_MATCHER(CXXRecordDecl, isMoveConstructible) {
 AST_MATCHER(CXXConstructorDecl, isNonDeletedCopyConstructor) {
   return Node.isCopyConstructor() && !Node.isDeleted();
 }
+
+/// \brief Matches move assignable classes.
+///
+/// Given
+/// \code
+///   // POD types are trivially move assignable
+///   struct Foo { int a; };
+///
+///   struct Bar {
+///     Bar &operator=(Bar &&) = deleted;
+///     int a;
+///   };
+/// \endcode
+/// recordDecl(isMoveAssignable())
+///   matches "Foo".
+AST_MATCHER(CXXRecordDecl, isMoveAssignable) {
+  for (CXXRecordDecl::method_iterator I = Node.method_begin(),
+                                      E = Node.method_end();
+       I != E; ++I) {
+    if (I->isMoveAssignmentOperator() && !I->isDeleted())
+      return true;
+  }
+  return false;
+}
+
+/// \brief Matches non-deleted copy assignment operators.
+///
+/// Given
+/// \code
+///   struct Foo { Foo &operator=(const Foo &) = default; };
+///   struct Bar { Bar &operator=(const Bar &) = deleted; };
+/// \endcode
+/// methodDecl(isNonDeletedCopyAssignmentOperator())
+///   matches "Foo &operator=(const Foo &)".
+AST_MATCHER(CXXMethodDecl, isNonDeletedCopyAssignmentOperator) {
+  return Node.isCopyAssignmentOperator() && !Node.isDeleted();
+}
 } // namespace ast_matchers
 } // namespace clang
 
@@ -92,3 +131,25 @@ DeclarationMatcher makePassByValueCtorParamMatcher() {
                                         .bind(PassByValueInitializerId)))
       .bind(PassByValueCtorId);
 }
+
+DeclarationMatcher makePassByValueSetterParamMatcher() {
+  return methodDecl(
+      // Only assignments that are statements of the body are matched: they
+      // run at most once per call, which isn't true in loops, for example.
+      // As for constructors, the assignment isn't resolved to a
+      // CXXOperatorCallExpr in dependent contexts.
+      hasBody(compoundStmt(forEach(
+          operatorCallExpr(
+              hasOverloadedOperatorName("="),
+              hasArgument(0, memberExpr(member(fieldDecl()), has(thisExpr()))),
+              hasArgument(
+                  1, declRefExpr(to(parmVarDecl(hasType(qualType(anyOf(
+                                                    constRefType(),
+                                                    nonConstValueType()))))
+                                        .bind(PassByValueParamId)))),
+              callee(methodDecl(
+                  isNonDeletedCopyAssignmentOperator(),
+                  ofClass(recordDecl(isMoveAssignable())))))
+              .bind(PassByValueAssignmentId)))))
+      .bind(PassByValueMethodId);
+}
@@ -23,6 +23,8 @@
 extern const char *PassByValueCtorId;
 extern const char *PassByValueParamId;
 extern const char *PassByValueInitializerId;
+extern const char *PassByValueMethodId;
+extern const char *PassByValueAssignmentId;
 /// @}
 
 /// \brief Creates a matcher that finds class field initializations that can
@@ -41,4 +43,20 @@ extern const char *PassByValueInitializerId;
 /// \endcode
 clang::ast_matchers::DeclarationMatcher makePassByValueCtorParamMatcher();
 
+/// \brief Creates a matcher that finds member functions copy-assigning one of
+/// their parameters to a class field, in a statement of the function body.
+///
+/// \code
+///   class A {
+///   public:
+///    void setS(const std::string &S) { this->S = S; }
+///    ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ PassByValueMethodId
+///              ~~~~~~~~~~~~~~~~~~~~ PassByValueParamId
+///                                      ~~~~~~~~~~~~~ PassByValueAssignmentId
+///   private:
+///    std::string S;
+///  };
+/// \endcode
+clang::ast_matchers::DeclarationMatcher makePassByValueSetterParamMatcher();
+
 #endif // CLANG_MODERNIZE_REPLACE_AUTO_PTR_MATCHERS_H
@@ -0,0 +1,65 @@
+//===-- UseEmplace/UseEmplace.cpp - Use emplace_back() --------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file provides the implementation of the UseEmplaceTransform
+/// class.
+///
+//===----------------------------------------------------------------------===//
+
+#include "UseEmplace.h"
+#include "UseEmplaceActions.h"
+#include "UseEmplaceMatchers.h"
+
+using namespace clang;
+using namespace clang::tooling;
+using namespace clang::ast_matchers;
+
+int UseEmplaceTransform::apply(const CompilationDatabase &Database,
+                               const std::vector<std::string> &SourcePaths) {
+  ClangTool Tool(Database, SourcePaths);
+  unsigned AcceptedChanges = 0;
+  unsigned RejectedChanges = 0;
+  MatchFinder Finder;
+  PushBackReplacer Replacer(AcceptedChanges, RejectedChanges,
+                            /*Owner=*/ *this);
+
+  Finder.addMatcher(makePushBackMatcher(), &Replacer);
+
+  if (Tool.run(createActionFactory(Finder))) {
+    llvm::errs() << "Error encountered during translation.\n";
+    return 1;
+  }
+
+  setAcceptedChanges(AcceptedChanges);
+  setRejectedChanges(RejectedChanges);
+  return 0;
+}
+
+struct UseEmplaceFactory : TransformFactory {
+  UseEmplaceFactory() {
+    // emplace_back() needs variadic templates and rvalue references.
+    Since.Clang = Version(3, 0);
+    Since.Gcc = Version(4, 4);
+    Since.Icc = Version(12, 1);
+    Since.Msvc = Version(12);
+  }
+
+  Transform *createTransform(const TransformOptions &Opts) override {
+    return new UseEmplaceTransform(Opts);
+  }
+};
+
+// Register the factory using this statically initialized variable.
+static TransformFactoryRegistry::Add<UseEmplaceFactory>
+X("use-emplace", "Construct container elements in place with emplace_back()");
+
+// This anchor is used to force the linker to link in the generated object file
+// and thus register the factory.
+volatile int UseEmplaceTransformAnchorSource = 0;
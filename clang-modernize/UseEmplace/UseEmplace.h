@@ -0,0 +1,50 @@
+//===-- UseEmplace/UseEmplace.h - Use emplace_back() ------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file provides the declaration of the UseEmplaceTransform
+/// class.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_USE_EMPLACE_H
+#define CLANG_MODERNIZE_USE_EMPLACE_H
+
+#include "Core/Transform.h"
+#include "llvm/Support/Compiler.h"
+
+/// \brief Subclass of Transform that replaces \c push_back() calls taking a
+/// temporary by calls to \c emplace_back() taking the constructor arguments.
+///
+/// The element is then constructed in place instead of being constructed as a
+/// temporary and moved (or copied) into the container.
+///
+/// For example, given:
+/// \code
+///   std::vector<std::pair<int, int> > v;
+///   v.push_back(std::pair<int, int>(1, 2));
+///   v.push_back(std::make_pair(3, 4));
+/// \endcode
+/// the code is transformed to:
+/// \code
+///   std::vector<std::pair<int, int> > v;
+///   v.emplace_back(1, 2);
+///   v.emplace_back(3, 4);
+/// \endcode
+class UseEmplaceTransform : public Transform {
+public:
+  UseEmplaceTransform(const TransformOptions &Options)
+      : Transform("UseEmplace", Options) {}
+
+  /// \see Transform::run().
+  virtual int apply(const clang::tooling::CompilationDatabase &Database,
+                    const std::vector<std::string> &SourcePaths) override;
+};
+
+#endif // CLANG_MODERNIZE_USE_EMPLACE_H
@@ -0,0 +1,188 @@
+//===-- UseEmplace/UseEmplaceActions.cpp - Use emplace_back() -------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the definition of the ASTMatcher callback for the
+/// UseEmplace transform.
+///
+//===----------------------------------------------------------------------===//
+
+#include "UseEmplaceActions.h"
+#include "Core/Transform.h"
+#include "UseEmplaceMatchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang;
+using namespace clang::tooling;
+using namespace clang::ast_matchers;
+
+namespace {
+
+/// \brief Strips the implicit nodes wrapping a temporary passed by reference.
+const Expr *ignoreTemporaryWrappers(const Expr *E) {
+  while (true) {
+    if (const ImplicitCastExpr *Cast = dyn_cast<ImplicitCastExpr>(E))
+      E = Cast->getSubExpr();
+    else if (const MaterializeTemporaryExpr *Temp =
+                 dyn_cast<MaterializeTemporaryExpr>(E))
+      E = Temp->GetTemporaryExpr();
+    else if (const CXXBindTemporaryExpr *Bind =
+                 dyn_cast<CXXBindTemporaryExpr>(E))
+      E = Bind->getSubExpr();
+    else if (const ExprWithCleanups *Cleanups = dyn_cast<ExprWithCleanups>(E))
+      E = Cleanups->getSubExpr();
+    else
+      return E;
+  }
+}
+
+/// \brief Whether \p Arg would still select the same constructor after being
+/// forwarded through \c emplace_back()'s parameter pack.
+bool isForwardable(const Expr *Arg) {
+  if (const ImplicitCastExpr *Cast = dyn_cast<ImplicitCastExpr>(Arg)) {
+    // '0' and 'NULL' are only null pointer constants when they aren't
+    // forwarded, function names may refer to overload sets.
+    if (Cast->getCastKind() == CK_NullToPointer ||
+        Cast->getCastKind() == CK_NullToMemberPointer ||
+        Cast->getCastKind() == CK_FunctionToPointerDecay)
+      return false;
+  }
+  const Expr *E = Arg->IgnoreParenImpCasts();
+  return !isa<InitListExpr>(E) && !isa<CXXStdInitializerListExpr>(E) &&
+         !E->refersToBitField() && !isa<CXXNullPtrLiteralExpr>(E) &&
+         !E->getType()->isNullPtrType();
+}
+
+/// \brief Whether \p D is declared in namespace \c std, ignoring inline
+/// namespaces. \see isFromStdNamespace().
+bool isInStdNamespace(const Decl *D) {
+  const DeclContext *DC = D->getDeclContext();
+  while (DC->isInlineNamespace())
+    DC = DC->getParent();
+  if (!DC->isNamespace() || !DC->getParent()->isTranslationUnit())
+    return false;
+  const IdentifierInfo *Info = cast<NamespaceDecl>(DC)->getIdentifier();
+  return Info && Info->isStr("std");
+}
+
+/// \brief Returns the arguments of the temporary \p Temp to pass to
+/// \c emplace_back() instead, or \c false if \p Temp can't be replaced.
+///
+/// \p Temp must construct an object of type \p ElementType.
+bool getConstructorArgs(const Expr *Temp, QualType ElementType,
+                        ASTContext &Context,
+                        llvm::SmallVectorImpl<const Expr *> &Args) {
+  if (!Context.hasSameUnqualifiedType(Temp->getType(), ElementType))
+    return false;
+
+  const Expr *const *ArgBegin = nullptr;
+  unsigned NumArgs = 0;
+  const CXXConstructExpr *Construct = nullptr;
+  // 'Foo(a)' is a functional cast around the constructor call, 'Foo()' and
+  // 'Foo(a, b)' are temporary objects. Implicit conversions aren't changed.
+  if (const CXXFunctionalCastExpr *Cast =
+          dyn_cast<CXXFunctionalCastExpr>(Temp)) {
+    if (Cast->getCastKind() == CK_ConstructorConversion)
+      Construct = dyn_cast<CXXConstructExpr>(
+          ignoreTemporaryWrappers(Cast->getSubExpr()));
+  } else {
+    Construct = dyn_cast<CXXTemporaryObjectExpr>(Temp);
+  }
+
+  if (Construct) {
+    if (Construct->isListInitialization() ||
+        Construct->getConstructor()->isExplicit() ||
+        Construct->getConstructor()->isCopyOrMoveConstructor())
+      return false;
+    ArgBegin = Construct->getArgs();
+    NumArgs = Construct->getNumArgs();
+  } else if (const CallExpr *Call = dyn_cast<CallExpr>(Temp)) {
+    const FunctionDecl *Callee = Call->getDirectCallee();
+    if (!Callee || !Callee->getIdentifier() ||
+        Callee->getName() != "make_pair" || !isInStdNamespace(Callee))
+      return false;
+    ArgBegin = Call->getArgs();
+    NumArgs = Call->getNumArgs();
+  } else {
+    return false;
+  }
+
+  for (unsigned I = 0; I != NumArgs; ++I) {
+    // Default arguments aren't spelled out.
+    if (isa<CXXDefaultArgExpr>(ArgBegin[I]))
+      break;
+    if (!isForwardable(ArgBegin[I]))
+      return false;
+    Args.push_back(ArgBegin[I]);
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+void PushBackReplacer::run(const MatchFinder::MatchResult &Result) {
+  SourceManager &SM = *Result.SourceManager;
+  ASTContext &Context = *Result.Context;
+  const CXXMemberCallExpr *Call =
+      Result.Nodes.getNodeAs<CXXMemberCallExpr>(PushBackCallId);
+  assert(Call && "Bad Callback. No node provided.");
+
+  const CXXRecordDecl *Container = Call->getRecordDecl();
+  const MemberExpr *Callee = dyn_cast<MemberExpr>(Call->getCallee());
+  if (!Container || !Callee ||
+      Container->lookup(DeclarationName(&Context.Idents.get("emplace_back")))
+          .empty())
+    return;
+
+  QualType ElementType =
+      Call->getMethodDecl()->getParamDecl(0)->getType().getNonReferenceType();
+  const Expr *Temp = ignoreTemporaryWrappers(Call->getArg(0));
+  llvm::SmallVector<const Expr *, 4> Args;
+  if (!getConstructorArgs(Temp, ElementType, Context, Args))
+    return;
+
+  // Everything that is replaced must be spelled in the same file.
+  SourceLocation NameLoc = Callee->getMemberLoc();
+  SourceLocation TempBegin = Temp->getLocStart();
+  SourceLocation TempEnd =
+      Lexer::getLocForEndOfToken(Temp->getLocEnd(), 0, SM, LangOptions());
+  // Without arguments the whole temporary is removed.
+  SourceLocation ArgsBegin = TempEnd;
+  SourceLocation ArgsEnd = TempEnd;
+  if (!Args.empty()) {
+    ArgsBegin = Args.front()->getLocStart();
+    ArgsEnd = Lexer::getLocForEndOfToken(Args.back()->getLocEnd(), 0, SM,
+                                         LangOptions());
+  }
+  if (NameLoc.isMacroID() || TempBegin.isMacroID() || TempEnd.isInvalid() ||
+      ArgsBegin.isMacroID() || ArgsEnd.isInvalid() ||
+      !Owner.isFileModifiable(SM, NameLoc))
+    return;
+
+  // Reject the changes if the risk level is not acceptable: unlike the
+  // temporary, the element is constructed after the container may have
+  // reallocated, which matters if the arguments refer to its elements.
+  if (!Owner.isAcceptableRiskLevel(RL_Reasonable)) {
+    RejectedChanges++;
+    return;
+  }
+
+  // 'v.push_back(Foo(a, b))' -> 'v.emplace_back(a, b)'
+  //    ~~~~~~~~~ ~~~~    ~        ~~~~~~~~~~~~
+  Owner.addReplacementForCurrentTU(
+      Replacement(SM, NameLoc, strlen("push_back"), "emplace_back"));
+  Owner.addReplacementForCurrentTU(Replacement(
+      SM, CharSourceRange::getCharRange(TempBegin, ArgsBegin), ""));
+  if (ArgsEnd != TempEnd)
+    Owner.addReplacementForCurrentTU(Replacement(
+        SM, CharSourceRange::getCharRange(ArgsEnd, TempEnd), ""));
+  ++AcceptedChanges;
+}
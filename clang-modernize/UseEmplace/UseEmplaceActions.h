@@ -0,0 +1,54 @@
+//===-- UseEmplace/UseEmplaceActions.h - Use emplace_back() -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the declaration of the ASTMatcher callback for the
+/// UseEmplace transform.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_USE_EMPLACE_ACTIONS_H
+#define CLANG_MODERNIZE_USE_EMPLACE_ACTIONS_H
+
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Tooling/Refactoring.h"
+
+class Transform;
+
+/// \brief Callback that replaces \c push_back() of a temporary by
+/// \c emplace_back() of the constructor arguments.
+///
+/// The temporary is either an explicit construction of the element type,
+/// which must not use an \c explicit constructor, or a call to
+/// \c std::make_pair() returning exactly the element type:
+/// \code
+///   v.push_back(Foo(a, b));               // v.emplace_back(a, b);
+///   m.push_back(std::make_pair(k, v));    // m.emplace_back(k, v);
+/// \endcode
+///
+/// Arguments that can't be perfectly forwarded (braced lists, null pointer
+/// literals, bit-fields, ...) prevent the change.
+class PushBackReplacer : public clang::ast_matchers::MatchFinder::MatchCallback {
+public:
+  PushBackReplacer(unsigned &AcceptedChanges, unsigned &RejectedChanges,
+                   Transform &Owner)
+      : AcceptedChanges(AcceptedChanges), RejectedChanges(RejectedChanges),
+        Owner(Owner) {}
+
+  /// \brief Entry point to the callback called when matches are made.
+  virtual void run(const clang::ast_matchers::MatchFinder::MatchResult &Result)
+      override;
+
+private:
+  unsigned &AcceptedChanges;
+  unsigned &RejectedChanges;
+  Transform &Owner;
+};
+
+#endif // CLANG_MODERNIZE_USE_EMPLACE_ACTIONS_H
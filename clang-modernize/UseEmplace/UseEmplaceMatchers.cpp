@@ -0,0 +1,34 @@
+//===-- UseEmplace/UseEmplaceMatchers.cpp - Use emplace_back() ------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the definitions for matcher-generating functions
+/// and names for bound nodes found by AST matchers.
+///
+//===----------------------------------------------------------------------===//
+
+#include "UseEmplaceMatchers.h"
+#include "Core/CustomMatchers.h"
+
+using namespace clang::ast_matchers;
+using namespace clang;
+
+const char *PushBackCallId = "PushBackCall";
+
+StatementMatcher makePushBackMatcher() {
+  DeclarationMatcher StdSequenceContainer =
+      recordDecl(anyOf(hasName("vector"), hasName("deque"), hasName("list")),
+                 isFromStdNamespace());
+
+  return memberCallExpr(
+             argumentCountIs(1),
+             callee(methodDecl(hasName("push_back"),
+                               ofClass(StdSequenceContainer))))
+      .bind(PushBackCallId);
+}
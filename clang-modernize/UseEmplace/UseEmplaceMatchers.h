@@ -0,0 +1,34 @@
+//===-- UseEmplace/UseEmplaceMatchers.h - Use emplace_back() ----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief This file contains the declarations for matcher-generating functions
+/// and names for bound nodes found by AST matchers.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_MODERNIZE_USE_EMPLACE_MATCHERS_H
+#define CLANG_MODERNIZE_USE_EMPLACE_MATCHERS_H
+
+#include "clang/ASTMatchers/ASTMatchers.h"
+
+/// \brief Name to bind with matched expressions.
+extern const char *PushBackCallId;
+
+/// \brief Creates a matcher that finds the calls to \c push_back() on the
+/// standard sequence containers providing \c emplace_back().
+///
+/// \code
+///   std::vector<Foo> v;
+///   v.push_back(Foo(1, 2));
+///   ^~~~~~~~~~~~~~~~~~~~~~
+/// \endcode
+clang::ast_matchers::StatementMatcher makePushBackMatcher();
+
+#endif // CLANG_MODERNIZE_USE_EMPLACE_MATCHERS_H
@@ -488,16 +488,20 @@ int main(int argc, const char **argv) {
 // These anchors are used to force the linker to link the transforms
 extern volatile int AddOverrideTransformAnchorSource;
 extern volatile int LoopConvertTransformAnchorSource;
+extern volatile int MakeSharedTransformAnchorSource;
 extern volatile int PassByValueTransformAnchorSource;
 extern volatile int ReplaceAutoPtrTransformAnchorSource;
 extern volatile int UseAutoTransformAnchorSource;
+extern volatile int UseEmplaceTransformAnchorSource;
 extern volatile int UseNullptrTransformAnchorSource;
 
 static int TransformsAnchorsDestination[] = {
   AddOverrideTransformAnchorSource,
   LoopConvertTransformAnchorSource,
+  MakeSharedTransformAnchorSource,
   PassByValueTransformAnchorSource,
   ReplaceAutoPtrTransformAnchorSource,
   UseAutoTransformAnchorSource,
+  UseEmplaceTransformAnchorSource,
   UseNullptrTransformAnchorSource
 };
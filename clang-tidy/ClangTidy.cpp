@@ -311,6 +311,24 @@ void ClangTidyCheck::setName(StringRef Name) {
   CheckName = Name.str();
 }
 
+std::string ClangTidyCheck::getOption(StringRef LocalName,
+                                      StringRef Default) const {
+  const ClangTidyOptions::OptionMap &CheckOptions =
+      Context->getOptions().CheckOptions;
+  auto Iter = CheckOptions.find((Twine(CheckName) + "." + LocalName).str());
+  if (Iter != CheckOptions.end())
+    return Iter->second;
+  return Default;
+}
+
+unsigned ClangTidyCheck::getOption(StringRef LocalName,
+                                   unsigned Default) const {
+  unsigned Result;
+  if (StringRef(getOption(LocalName, "")).getAsInteger(10, Result))
+    return Default;
+  return Result;
+}
+
 std::vector<std::string> getCheckNames(const ClangTidyOptions &Options) {
   clang::tidy::ClangTidyContext Context(
       new DefaultOptionsProvider(ClangTidyGlobalOptions(), Options));
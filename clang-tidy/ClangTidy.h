@@ -86,6 +86,20 @@ public:
   /// framework. Can be called only once.
   void setName(StringRef Name);
 
+protected:
+  /// \brief Reads the option named \p LocalName of this check from
+  /// \c ClangTidyOptions::CheckOptions.
+  ///
+  /// The option is looked up as "<check-name>.<LocalName>". Returns
+  /// \p Default if the option is not set. Options are available from
+  /// \c registerMatchers() on.
+  std::string getOption(StringRef LocalName, StringRef Default) const;
+
+  /// \brief Reads the integer option named \p LocalName of this check.
+  ///
+  /// Returns \p Default if the option is not set or isn't an integer.
+  unsigned getOption(StringRef LocalName, unsigned Default) const;
+
 private:
   void run(const ast_matchers::MatchFinder::MatchResult &Result) override;
   ClangTidyContext *Context;
@@ -11,6 +11,7 @@
 #define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_CLANG_TIDY_OPTIONS_H
 
 #include "llvm/ADT/StringRef.h"
+#include <map>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -54,6 +55,15 @@ struct ClangTidyOptions {
 
   /// \brief Turns on temporary destructor-based analysis.
   bool AnalyzeTemporaryDtors;
+
+  typedef std::pair<std::string, std::string> StringPair;
+  typedef std::map<std::string, std::string> OptionMap;
+
+  /// \brief Key-value mapping used to store check-specific options.
+  ///
+  /// Keys have the form "<check-name>.<option-name>", e.g.
+  /// "performance-unnecessary-value-param.SizeThreshold".
+  OptionMap CheckOptions;
 };
 
 /// \brief Abstract interface for retrieving various ClangTidy options.
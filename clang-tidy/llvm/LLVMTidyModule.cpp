@@ -12,6 +12,9 @@
 #include "../ClangTidyModuleRegistry.h"
 #include "IncludeOrderCheck.h"
 #include "NamespaceCommentCheck.h"
+#include "PreferDenseContainersCheck.h"
+#include "PreferFunctionRefCheck.h"
+#include "PreferSmallVectorCheck.h"
 
 namespace clang {
 namespace tidy {
@@ -24,6 +27,15 @@ public:
     CheckFactories.addCheckFactory(
         "llvm-namespace-comment",
         new ClangTidyCheckFactory<NamespaceCommentCheck>());
+    CheckFactories.addCheckFactory(
+        "llvm-prefer-dense-containers",
+        new ClangTidyCheckFactory<PreferDenseContainersCheck>());
+    CheckFactories.addCheckFactory(
+        "llvm-prefer-function-ref",
+        new ClangTidyCheckFactory<PreferFunctionRefCheck>());
+    CheckFactories.addCheckFactory(
+        "llvm-prefer-small-vector",
+        new ClangTidyCheckFactory<PreferSmallVectorCheck>());
   }
 };
 
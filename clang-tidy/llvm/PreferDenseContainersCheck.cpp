@@ -0,0 +1,217 @@
+//===--- PreferDenseContainersCheck.cpp - clang-tidy ----------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "PreferDenseContainersCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+
+namespace {
+/// \brief Matches typedefs and alias declarations.
+AST_MATCHER(NamedDecl, isTypedefName) { return isa<TypedefNameDecl>(Node); }
+} // namespace
+
+void PreferDenseContainersCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(varDecl().bind("decl"), this);
+  Finder->addMatcher(fieldDecl().bind("decl"), this);
+  Finder->addMatcher(namedDecl(isTypedefName()).bind("decl"), this);
+}
+
+namespace {
+/// \brief Finds uses of a variable or field that depend on the order of the
+/// container's elements.
+class OrderedUseFinder : public RecursiveASTVisitor<OrderedUseFinder> {
+public:
+  explicit OrderedUseFinder(const ValueDecl &Container)
+      : Container(Container), Found(false) {}
+
+  bool found() const { return Found; }
+
+  bool VisitCXXForRangeStmt(CXXForRangeStmt *ForRange) {
+    if (refersToContainer(ForRange->getRangeInit()))
+      Found = true;
+    return !Found;
+  }
+
+  bool VisitCXXMemberCallExpr(CXXMemberCallExpr *Call) {
+    const CXXMethodDecl *Method = Call->getMethodDecl();
+    if (!Method || !Method->getIdentifier())
+      return true;
+    StringRef Name = Method->getName();
+    if ((Name == "begin" || Name == "cbegin" || Name == "rbegin" ||
+         Name == "crbegin" || Name == "lower_bound" || Name == "upper_bound" ||
+         Name == "equal_range") &&
+        refersToContainer(Call->getImplicitObjectArgument()))
+      Found = true;
+    return !Found;
+  }
+
+private:
+  bool refersToContainer(const Expr *E) const {
+    if (!E)
+      return false;
+    E = E->IgnoreParenImpCasts();
+    if (const auto *Ref = dyn_cast<DeclRefExpr>(E))
+      return Ref->getDecl() == &Container;
+    if (const auto *Member = dyn_cast<MemberExpr>(E))
+      return Member->getMemberDecl() == &Container;
+    return false;
+  }
+
+  const ValueDecl &Container;
+  bool Found;
+};
+
+/// \brief Collects the variables and fields whose type is spelled with a
+/// typedef.
+class TypedefUserFinder : public RecursiveASTVisitor<TypedefUserFinder> {
+public:
+  TypedefUserFinder(const TypedefNameDecl &Typedef,
+                    SmallVectorImpl<const ValueDecl *> &Users)
+      : Typedef(Typedef), Users(Users) {}
+
+  bool VisitVarDecl(VarDecl *Var) {
+    addIfUser(Var);
+    return true;
+  }
+
+  bool VisitFieldDecl(FieldDecl *Field) {
+    addIfUser(Field);
+    return true;
+  }
+
+private:
+  void addIfUser(const ValueDecl *D) {
+    const auto *Type = D->getType()->getAs<TypedefType>();
+    if (Type && Type->getDecl()->getCanonicalDecl() ==
+                    Typedef.getCanonicalDecl())
+      Users.push_back(D);
+  }
+
+  const TypedefNameDecl &Typedef;
+  SmallVectorImpl<const ValueDecl *> &Users;
+};
+} // namespace
+
+/// \brief Whether the order of the elements of \p Container is used in the
+/// function containing it or, for fields, in the methods of its class.
+static bool isOrderUsed(const ValueDecl &Container) {
+  OrderedUseFinder Finder(Container);
+  if (const auto *Var = dyn_cast<VarDecl>(&Container)) {
+    const auto *Function =
+        dyn_cast_or_null<FunctionDecl>(Var->getParentFunctionOrMethod());
+    if (Function && Function->getBody())
+      Finder.TraverseStmt(Function->getBody());
+    return Finder.found();
+  }
+  const auto *Record = dyn_cast<CXXRecordDecl>(Container.getDeclContext());
+  if (!Record)
+    return false;
+  for (CXXRecordDecl::method_iterator I = Record->method_begin(),
+                                      E = Record->method_end();
+       I != E && !Finder.found(); ++I) {
+    const FunctionDecl *Definition = nullptr;
+    if (I->hasBody(Definition))
+      Finder.TraverseDecl(const_cast<FunctionDecl *>(Definition));
+  }
+  return Finder.found();
+}
+
+/// \brief Whether the order of the elements is used for one of the variables
+/// or fields declared with \p Typedef in the translation unit.
+static bool isOrderUsed(const TypedefNameDecl &Typedef, ASTContext &Context) {
+  SmallVector<const ValueDecl *, 4> Users;
+  TypedefUserFinder(Typedef, Users)
+      .TraverseDecl(Context.getTranslationUnitDecl());
+  for (const ValueDecl *User : Users) {
+    if (isOrderUsed(*User))
+      return true;
+  }
+  return false;
+}
+
+void PreferDenseContainersCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *D = Result.Nodes.getNodeAs<NamedDecl>("decl");
+  if (D->isImplicit() || D->getLocation().isInvalid() ||
+      D->getLocation().isMacroID() ||
+      Result.SourceManager->isInSystemHeader(D->getLocation()))
+    return;
+  // Declarations in instantiations are reported in the template.
+  const DeclContext *DC = D->getDeclContext();
+  if (isa<ClassTemplateSpecializationDecl>(DC))
+    return;
+  if (const auto *Function = dyn_cast<FunctionDecl>(DC))
+    if (Function->isTemplateInstantiation())
+      return;
+
+  QualType Type;
+  if (const auto *Var = dyn_cast<VarDecl>(D)) {
+    if (!Var->isLocalVarDecl() || isa<ParmVarDecl>(Var))
+      return;
+    Type = Var->getType();
+  } else if (const auto *Field = dyn_cast<FieldDecl>(D)) {
+    Type = Field->getType();
+  } else {
+    Type = cast<TypedefNameDecl>(D)->getUnderlyingType();
+  }
+  // Containers spelled with a typedef are reported at the typedef.
+  if (!isa<TypedefNameDecl>(D) && Type->getAs<TypedefType>())
+    return;
+
+  const auto *Container = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      Type->getAsCXXRecordDecl());
+  if (!Container || Container->getTemplateArgs().size() < 1 ||
+      Container->getTemplateArgs()[0].getKind() != TemplateArgument::Type)
+    return;
+  std::string Name = Container->getQualifiedNameAsString();
+  bool IsMap = Name == "std::map" || Name == "std::unordered_map";
+  bool IsOrdered = Name == "std::map" || Name == "std::set";
+  if (!IsMap && !IsOrdered && Name != "std::unordered_set")
+    return;
+  QualType Key = Container->getTemplateArgs()[0].getAsType();
+  bool IsPointer = Key->isPointerType();
+  if (!IsPointer && (!Key->isIntegerType() || Key->isBooleanType() ||
+                     Key->isEnumeralType()))
+    return;
+
+  const char *Replacement =
+      IsMap ? "llvm::DenseMap"
+            : (IsPointer ? "llvm::SmallPtrSet" : "llvm::DenseSet");
+  bool IsOrderUsed = false;
+  if (IsOrdered) {
+    if (const auto *Typedef = dyn_cast<TypedefNameDecl>(D))
+      IsOrderUsed = isOrderUsed(*Typedef, *Result.Context);
+    else
+      IsOrderUsed = isOrderUsed(*cast<ValueDecl>(D));
+  }
+  if (IsOrderUsed) {
+    diag(D->getLocation(),
+         "%0 depends on the iteration order of '%1', so it isn't suggested to "
+         "use '%2'; consider '%3' if the insertion order is sufficient")
+        << D << Name << Replacement
+        << (IsMap ? "llvm::MapVector" : "llvm::SetVector");
+    return;
+  }
+  diag(D->getLocation(), "%0 uses '%1' with %select{integer|pointer}2 keys; "
+                         "consider using '%3' instead, which doesn't allocate "
+                         "a node per element")
+      << D << Name << IsPointer << Replacement;
+}
+
+} // namespace tidy
+} // namespace clang
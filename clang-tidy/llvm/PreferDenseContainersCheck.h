@@ -0,0 +1,47 @@
+//===--- PreferDenseContainersCheck.h - clang-tidy --------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_DENSE_CONTAINERS_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_DENSE_CONTAINERS_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+
+/// \brief Finds local variables, fields and typedefs of \c std::map,
+/// \c std::set, \c std::unordered_map and \c std::unordered_set keyed by
+/// pointers or integers, and suggests \c llvm::DenseMap, \c llvm::DenseSet or
+/// \c llvm::SmallPtrSet.
+///
+/// Example:
+/// \code
+///   std::map<const Decl *, unsigned> Indices;   // use llvm::DenseMap
+///   std::set<Value *> Visited;                  // use llvm::SmallPtrSet
+/// \endcode
+///
+/// The LLVM containers iterate in an unspecified order. Ordered containers
+/// whose order is used (iterated, or searched with \c lower_bound and friends)
+/// are reported with a different message suggesting \c llvm::MapVector or
+/// \c llvm::SetVector. Uses of fields are looked for in the methods of their
+/// class. Containers declared with a typedef or alias are reported at the
+/// typedef, considering the uses of all variables and fields declared with it
+/// in the translation unit.
+///
+/// see: http://llvm.org/docs/ProgrammersManual.html#map-like-containers-std-map-densemap-etc
+class PreferDenseContainersCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_DENSE_CONTAINERS_CHECK_H
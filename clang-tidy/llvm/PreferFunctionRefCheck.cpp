@@ -0,0 +1,200 @@
+//===--- PreferFunctionRefCheck.cpp - clang-tidy --------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "PreferFunctionRefCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/TypeLoc.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+#include "llvm/ADT/SmallVector.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+
+void PreferFunctionRefCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(parmVarDecl().bind("param"), this);
+}
+
+namespace {
+/// \brief Collects the references to a parameter.
+class ParamRefCollector : public RecursiveASTVisitor<ParamRefCollector> {
+public:
+  ParamRefCollector(const ParmVarDecl &Param,
+                    SmallVectorImpl<const DeclRefExpr *> &Refs)
+      : Param(Param), Refs(Refs) {}
+
+  bool VisitDeclRefExpr(DeclRefExpr *E) {
+    if (E->getDecl() == &Param)
+      Refs.push_back(E);
+    return true;
+  }
+
+private:
+  const ParmVarDecl &Param;
+  SmallVectorImpl<const DeclRefExpr *> &Refs;
+};
+} // namespace
+
+/// \brief Returns the \c std::function specialization \p Type refers to, if
+/// it is passed by value or const reference.
+static const ClassTemplateSpecializationDecl *getStdFunction(QualType Type) {
+  if (const auto *Ref = Type->getAs<LValueReferenceType>()) {
+    Type = Ref->getPointeeType();
+    if (!Type.isConstQualified())
+      return nullptr;
+  } else if (Type->isReferenceType()) {
+    return nullptr;
+  }
+  const auto *Function = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      Type->getAsCXXRecordDecl());
+  if (!Function || Function->getQualifiedNameAsString() != "std::function" ||
+      Function->getTemplateArgs().size() != 1 ||
+      Function->getTemplateArgs()[0].getKind() != TemplateArgument::Type)
+    return nullptr;
+  return Function;
+}
+
+/// \brief Whether \p S is part of a lambda.
+static bool isInLambda(const Stmt *S, const ParentMap &Parents) {
+  for (const Stmt *Parent = Parents.getParent(S); Parent;
+       Parent = Parents.getParent(Parent)) {
+    if (isa<LambdaExpr>(Parent))
+      return true;
+  }
+  return false;
+}
+
+/// \brief Whether every use of \p Param in \p Body calls it.
+///
+/// Uses in lambdas are rejected: a lambda capturing the parameter by copy
+/// stores it, and its captures aren't visited as references.
+static bool isOnlyCalled(const ParmVarDecl &Param, const Stmt &Body) {
+  SmallVector<const DeclRefExpr *, 4> Refs;
+  ParamRefCollector(Param, Refs).TraverseStmt(const_cast<Stmt *>(&Body));
+  if (Refs.empty())
+    return false;
+  ParentMap Parents(const_cast<Stmt *>(&Body));
+  for (const DeclRefExpr *Ref : Refs) {
+    if (isInLambda(Ref, Parents))
+      return false;
+    const Stmt *Child = Ref;
+    const Stmt *Parent = Parents.getParent(Child);
+    while (Parent && (isa<ParenExpr>(Parent) ||
+                      (isa<ImplicitCastExpr>(Parent) &&
+                       cast<ImplicitCastExpr>(Parent)->getCastKind() ==
+                           CK_NoOp))) {
+      Child = Parent;
+      Parent = Parents.getParent(Child);
+    }
+    const auto *Call = dyn_cast_or_null<CXXOperatorCallExpr>(Parent);
+    if (!Call || Call->getOperator() != OO_Call || Call->getArg(0) != Child)
+      return false;
+  }
+  return true;
+}
+
+/// \brief Creates the fix replacing the type of \p Param with
+/// 'llvm::function_ref<Signature>'. Returns \c false if the type isn't
+/// spelled as a \c std::function specialization.
+static bool makeFunctionRefFix(const ParmVarDecl &Param,
+                               const SourceManager &SM,
+                               const LangOptions &LangOpts,
+                               SmallVectorImpl<FixItHint> &Fixes) {
+  const TypeSourceInfo *TSI = Param.getTypeSourceInfo();
+  if (!TSI || !Param.getIdentifier())
+    return false;
+  TypeLoc TL = TSI->getTypeLoc();
+  if (ReferenceTypeLoc Ref = TL.getAs<ReferenceTypeLoc>())
+    TL = Ref.getPointeeLoc();
+  if (QualifiedTypeLoc Qualified = TL.getAs<QualifiedTypeLoc>())
+    TL = Qualified.getUnqualifiedLoc();
+  if (ElaboratedTypeLoc Elaborated = TL.getAs<ElaboratedTypeLoc>())
+    TL = Elaborated.getNamedTypeLoc();
+  TemplateSpecializationTypeLoc Specialization =
+      TL.getAs<TemplateSpecializationTypeLoc>();
+  if (!Specialization || Specialization.getNumArgs() != 1)
+    return false;
+
+  // The type location doesn't include leading cv-qualifiers, which must be
+  // removed as well.
+  SourceLocation Begin = Param.getLocStart();
+  if (Begin.isInvalid() || Begin.isMacroID() ||
+      Param.getLocation().isMacroID())
+    return false;
+  StringRef Signature = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(
+          Specialization.getArgLoc(0).getSourceRange()),
+      SM, LangOpts);
+  if (Signature.empty())
+    return false;
+  Fixes.push_back(FixItHint::CreateReplacement(
+      CharSourceRange::getCharRange(Begin, Param.getLocation()),
+      ("llvm::function_ref<" + Signature + "> ").str()));
+  return true;
+}
+
+void PreferFunctionRefCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Param = Result.Nodes.getNodeAs<ParmVarDecl>("param");
+  const auto *Function = dyn_cast<FunctionDecl>(Param->getDeclContext());
+  if (!Function || !Function->doesThisDeclarationHaveABody() ||
+      !Function->getBody() || Function->isImplicit() ||
+      Function->isTemplateInstantiation() || !Param->getIdentifier() ||
+      Param->getLocation().isMacroID())
+    return;
+  const auto *Method = dyn_cast<CXXMethodDecl>(Function);
+  if (Method && Method->isVirtual())
+    return;
+
+  const ClassTemplateSpecializationDecl *StdFunction =
+      getStdFunction(Param->getType());
+  if (!StdFunction || !isOnlyCalled(*Param, *Function->getBody()))
+    return;
+  if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(Function)) {
+    for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+                                                 E = Ctor->init_end();
+         I != E; ++I) {
+      SmallVector<const DeclRefExpr *, 4> Refs;
+      ParamRefCollector(*Param, Refs).TraverseStmt((*I)->getInit());
+      if (!Refs.empty())
+        return;
+    }
+  }
+
+  DiagnosticBuilder Diag =
+      diag(Param->getLocation(),
+           "parameter %0 is only called; consider passing it as "
+           "'llvm::function_ref<%1>' so that callers don't have to construct "
+           "a 'std::function'")
+      << Param
+      << StdFunction->getTemplateArgs()[0].getAsType().getAsString(
+             Result.Context->getPrintingPolicy());
+
+  // Fix all redeclarations or none of them.
+  unsigned Index = Param->getFunctionScopeIndex();
+  SmallVector<FixItHint, 4> Fixes;
+  for (FunctionDecl::redecl_iterator I = Function->redecls_begin(),
+                                     E = Function->redecls_end();
+       I != E; ++I) {
+    if (Index >= I->getNumParams() ||
+        !makeFunctionRefFix(*I->getParamDecl(Index), *Result.SourceManager,
+                            Result.Context->getLangOpts(), Fixes))
+      return;
+  }
+  for (const FixItHint &Fix : Fixes)
+    Diag << Fix;
+}
+
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,42 @@
+//===--- PreferFunctionRefCheck.h - clang-tidy ------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_FUNCTION_REF_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_FUNCTION_REF_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+
+/// \brief Finds \c std::function parameters, by value or const reference,
+/// that the function only calls, and suggests \c llvm::function_ref.
+///
+/// Callers passing a lambda have to construct a \c std::function, which may
+/// allocate; \c llvm::function_ref only refers to the callable.
+///
+/// Example:
+/// \code
+///   void visit(const std::function<void(Node *)> &F);
+///   ==>  void visit(llvm::function_ref<void(Node *)> F);
+/// \endcode
+///
+/// The fix is applied to all redeclarations of the function, as long as each
+/// spells the \c std::function type directly. It doesn't add the include of
+/// "llvm/ADT/STLExtras.h".
+class PreferFunctionRefCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_FUNCTION_REF_CHECK_H
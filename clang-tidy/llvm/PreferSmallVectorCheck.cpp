@@ -0,0 +1,403 @@
+//===--- PreferSmallVectorCheck.cpp - clang-tidy --------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "PreferSmallVectorCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/AST/TypeLoc.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+#include "llvm/ADT/SmallVector.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+
+PreferSmallVectorCheck::PreferSmallVectorCheck() : MaxElements(16) {}
+
+void PreferSmallVectorCheck::registerMatchers(MatchFinder *Finder) {
+  MaxElements = getOption("MaxElements", MaxElements);
+  Finder->addMatcher(varDecl().bind("var"), this);
+}
+
+namespace {
+/// \brief Collects the references to a variable.
+class VarRefCollector : public RecursiveASTVisitor<VarRefCollector> {
+public:
+  VarRefCollector(const VarDecl &Var,
+                  SmallVectorImpl<const DeclRefExpr *> &Refs)
+      : Var(Var), Refs(Refs) {}
+
+  bool VisitDeclRefExpr(DeclRefExpr *E) {
+    if (E->getDecl() == &Var)
+      Refs.push_back(E);
+    return true;
+  }
+
+private:
+  const VarDecl &Var;
+  SmallVectorImpl<const DeclRefExpr *> &Refs;
+};
+
+/// \brief Finds assignments and increments of a loop counter.
+class CounterWriteFinder : public RecursiveASTVisitor<CounterWriteFinder> {
+public:
+  explicit CounterWriteFinder(const VarDecl &Counter)
+      : Counter(Counter), Found(false) {}
+
+  bool found() const { return Found; }
+
+  bool VisitBinaryOperator(BinaryOperator *Op) {
+    if (Op->isAssignmentOp() && refersToCounter(Op->getLHS()))
+      Found = true;
+    return !Found;
+  }
+
+  bool VisitUnaryOperator(UnaryOperator *Op) {
+    if ((Op->isIncrementDecrementOp() || Op->getOpcode() == UO_AddrOf) &&
+        refersToCounter(Op->getSubExpr()))
+      Found = true;
+    return !Found;
+  }
+
+private:
+  bool refersToCounter(const Expr *E) const {
+    const auto *Ref = dyn_cast<DeclRefExpr>(E->IgnoreParenImpCasts());
+    return Ref && Ref->getDecl() == &Counter;
+  }
+
+  const VarDecl &Counter;
+  bool Found;
+};
+} // namespace
+
+/// \brief Returns the number of iterations of
+/// 'for (T I = Start; I < or <= or != End; ++I)' with constant bounds, or -1.
+static int64_t getConstantTripCount(const ForStmt &For,
+                                    const ASTContext &Context) {
+  const auto *Init = dyn_cast_or_null<DeclStmt>(For.getInit());
+  if (!Init || !Init->isSingleDecl())
+    return -1;
+  const auto *Counter = dyn_cast<VarDecl>(Init->getSingleDecl());
+  llvm::APSInt Start, End;
+  if (!Counter || !Counter->getType()->isIntegerType() || !Counter->getInit() ||
+      !Counter->getInit()->EvaluateAsInt(Start, Context))
+    return -1;
+
+  const auto *Cond = dyn_cast_or_null<BinaryOperator>(For.getCond());
+  if (!Cond || (Cond->getOpcode() != BO_LT && Cond->getOpcode() != BO_LE &&
+                Cond->getOpcode() != BO_NE))
+    return -1;
+  const auto *CondVar =
+      dyn_cast<DeclRefExpr>(Cond->getLHS()->IgnoreParenImpCasts());
+  if (!CondVar || CondVar->getDecl() != Counter ||
+      !Cond->getRHS()->EvaluateAsInt(End, Context))
+    return -1;
+
+  const auto *Inc = dyn_cast_or_null<UnaryOperator>(For.getInc());
+  if (!Inc || !Inc->isIncrementOp())
+    return -1;
+  const auto *IncVar =
+      dyn_cast<DeclRefExpr>(Inc->getSubExpr()->IgnoreParenImpCasts());
+  if (!IncVar || IncVar->getDecl() != Counter)
+    return -1;
+
+  CounterWriteFinder Writes(*Counter);
+  Writes.TraverseStmt(const_cast<Stmt *>(For.getBody()));
+  if (Writes.found())
+    return -1;
+
+  int64_t Count = End.getExtValue() - Start.getExtValue() +
+                  (Cond->getOpcode() == BO_LE ? 1 : 0);
+  if (Count < 0)
+    return Cond->getOpcode() == BO_NE ? -1 : 0;
+  return Count;
+}
+
+/// \brief Returns the number of iterations of a range-based for loop over a
+/// constant array or a braced list, or -1.
+static int64_t getConstantTripCount(const CXXForRangeStmt &ForRange,
+                                    const ASTContext &Context) {
+  const Expr *Range = ForRange.getRangeInit();
+  if (!Range)
+    return -1;
+  if (const ConstantArrayType *Array =
+          Context.getAsConstantArrayType(Range->getType()))
+    return Array->getSize().getZExtValue();
+  Range = Range->IgnoreImplicit();
+  if (const auto *List = dyn_cast<CXXStdInitializerListExpr>(Range)) {
+    if (const ConstantArrayType *Array = Context.getAsConstantArrayType(
+            List->getSubExpr()->IgnoreImplicit()->getType()))
+      return Array->getSize().getZExtValue();
+  }
+  return -1;
+}
+
+/// \brief Returns how often \p S may run per execution of \p Body, as the
+/// product of the trip counts of the enclosing loops, or -1 if one of them
+/// isn't known.
+static int64_t getExecutionCount(const Stmt *S, const Stmt *Body,
+                                 const ParentMap &Parents,
+                                 const ASTContext &Context, int64_t Limit) {
+  int64_t Count = 1;
+  for (const Stmt *Child = S, *Parent = Parents.getParent(S);
+       Parent && Child != Body; Child = Parent,
+                  Parent = Parents.getParent(Parent)) {
+    int64_t TripCount = 1;
+    if (const auto *For = dyn_cast<ForStmt>(Parent)) {
+      if (Child == For->getBody())
+        TripCount = getConstantTripCount(*For, Context);
+    } else if (const auto *ForRange = dyn_cast<CXXForRangeStmt>(Parent)) {
+      if (Child == ForRange->getBody())
+        TripCount = getConstantTripCount(*ForRange, Context);
+    } else if (isa<WhileStmt>(Parent) || isa<DoStmt>(Parent)) {
+      TripCount = -1;
+    } else if (isa<LambdaExpr>(Parent)) {
+      return -1;
+    }
+    if (TripCount < 0)
+      return -1;
+    Count *= TripCount;
+    if (Count > Limit)
+      return Count;
+  }
+  return Count;
+}
+
+/// \brief Returns the number of elements \p Var is initialized with, or -1.
+static int64_t getInitialSize(const VarDecl &Var, const ASTContext &Context) {
+  const auto *Construct =
+      dyn_cast_or_null<CXXConstructExpr>(Var.getInit()
+                                             ? Var.getInit()->IgnoreImplicit()
+                                             : nullptr);
+  if (!Construct)
+    return -1;
+  unsigned NumArgs = 0;
+  while (NumArgs != Construct->getNumArgs() &&
+         !isa<CXXDefaultArgExpr>(Construct->getArg(NumArgs)))
+    ++NumArgs;
+  if (NumArgs == 0)
+    return 0;
+  if (NumArgs != 1)
+    return -1;
+  const Expr *Arg = Construct->getArg(0)->IgnoreImplicit();
+  if (const auto *List = dyn_cast<CXXStdInitializerListExpr>(Arg)) {
+    if (const ConstantArrayType *Array = Context.getAsConstantArrayType(
+            List->getSubExpr()->IgnoreImplicit()->getType()))
+      return Array->getSize().getZExtValue();
+    return -1;
+  }
+  // 'std::vector<T> V(N)'.
+  llvm::APSInt Size;
+  if (Arg->getType()->isIntegerType() && Arg->EvaluateAsInt(Size, Context))
+    return Size.getExtValue();
+  return -1;
+}
+
+/// \brief Whether the iterator or pointer returned by \p Call is only used in
+/// a way that doesn't spell its type: as a call argument, as an argument of a
+/// range constructor, to initialize an \c auto variable or as the range of a
+/// range-based for loop.
+static bool hasTypeIndependentUse(const CXXMemberCallExpr *Call,
+                                  const ParentMap &Parents) {
+  const Stmt *Child = Call;
+  const Stmt *Parent = Parents.getParent(Child);
+  while (Parent &&
+         (isa<ImplicitCastExpr>(Parent) || isa<ParenExpr>(Parent) ||
+          isa<MaterializeTemporaryExpr>(Parent) ||
+          isa<CXXBindTemporaryExpr>(Parent) || isa<ExprWithCleanups>(Parent) ||
+          (isa<CXXConstructExpr>(Parent) &&
+           cast<CXXConstructExpr>(Parent)->getConstructor()
+               ->isCopyOrMoveConstructor()))) {
+    Child = Parent;
+    Parent = Parents.getParent(Child);
+  }
+  if (!Parent)
+    return false;
+
+  // Range constructors, e.g. 'std::vector<T> W(V.begin(), V.end())', are
+  // templates accepting any iterator. Other constructors, including
+  // converting ones like the one building a 'const_iterator', spell the
+  // iterator type.
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(Parent)) {
+    unsigned NumArgs = 0;
+    while (NumArgs != Construct->getNumArgs() &&
+           !isa<CXXDefaultArgExpr>(Construct->getArg(NumArgs)))
+      ++NumArgs;
+    return Construct->getConstructor()->getPrimaryTemplate() && NumArgs > 1;
+  }
+  if (const auto *CallParent = dyn_cast<CallExpr>(Parent))
+    return CallParent->getCallee() != Child;
+  const auto *DS = dyn_cast<DeclStmt>(Parent);
+  if (!DS)
+    return false;
+  if (const auto *ForRange =
+          dyn_cast_or_null<CXXForRangeStmt>(Parents.getParent(DS))) {
+    if (ForRange->getRangeStmt() == DS)
+      return true;
+  }
+  for (DeclStmt::const_decl_iterator I = DS->decl_begin(),
+                                     E = DS->decl_end();
+       I != E; ++I) {
+    const auto *Var = dyn_cast<VarDecl>(*I);
+    if (Var && Var->getInit() == Child)
+      return Var->getType()->getContainedAutoType() != nullptr;
+  }
+  return false;
+}
+
+/// \brief Returns how many elements the use \p Ref of the vector may add, or
+/// -1 if the use isn't understood or doesn't work with \c SmallVector.
+///
+/// \p Fixable is set to false if the use relies on the type of the vector,
+/// e.g. stores 'V.begin()' in a 'std::vector<T>::iterator'.
+static int64_t getAddedElements(const DeclRefExpr &Ref, const Stmt *Body,
+                                const ParentMap &Parents,
+                                const ASTContext &Context, int64_t Limit,
+                                bool &Fixable) {
+  const Stmt *Child = &Ref;
+  const Stmt *Parent = Parents.getParent(Child);
+  while (Parent && (isa<ParenExpr>(Parent) ||
+                    (isa<ImplicitCastExpr>(Parent) &&
+                     cast<ImplicitCastExpr>(Parent)->getCastKind() ==
+                         CK_NoOp))) {
+    Child = Parent;
+    Parent = Parents.getParent(Child);
+  }
+  if (!Parent)
+    return -1;
+
+  if (const auto *OpCall = dyn_cast<CXXOperatorCallExpr>(Parent))
+    return OpCall->getOperator() == OO_Subscript &&
+                   OpCall->getArg(0) == Child
+               ? 0
+               : -1;
+
+  // 'for (auto &X : V)' binds the vector to the range variable.
+  if (const auto *DS = dyn_cast<DeclStmt>(Parent)) {
+    const auto *ForRange =
+        dyn_cast_or_null<CXXForRangeStmt>(Parents.getParent(DS));
+    return ForRange && ForRange->getRangeStmt() == DS ? 0 : -1;
+  }
+
+  const auto *Member = dyn_cast<MemberExpr>(Parent);
+  const auto *Call = dyn_cast_or_null<CXXMemberCallExpr>(
+      Member ? Parents.getParent(Member) : nullptr);
+  if (!Call || !Call->getMethodDecl() ||
+      !Call->getMethodDecl()->getIdentifier())
+    return -1;
+  StringRef Name = Call->getMethodDecl()->getName();
+  if (Name == "push_back" || Name == "emplace_back")
+    return getExecutionCount(Call, Body, Parents, Context, Limit);
+  if (Name == "begin" || Name == "end" || Name == "rbegin" || Name == "rend" ||
+      Name == "data") {
+    if (!hasTypeIndependentUse(Call, Parents))
+      Fixable = false;
+    return 0;
+  }
+  if (Name == "size" || Name == "empty" || Name == "front" ||
+      Name == "back" || Name == "clear" || Name == "pop_back" ||
+      Name == "capacity")
+    return 0;
+  return -1;
+}
+
+/// \brief Creates the fix replacing the written 'std::vector<T>' type of
+/// \p Var with 'llvm::SmallVector<T, N>'.
+static bool makeSmallVectorFix(const VarDecl &Var, int64_t N,
+                               const SourceManager &SM,
+                               const LangOptions &LangOpts,
+                               SmallVectorImpl<FixItHint> &Fixes) {
+  const TypeSourceInfo *TSI = Var.getTypeSourceInfo();
+  if (!TSI)
+    return false;
+  TypeLoc Full = TSI->getTypeLoc();
+  TypeLoc TL = Full;
+  if (ElaboratedTypeLoc Elaborated = TL.getAs<ElaboratedTypeLoc>())
+    TL = Elaborated.getNamedTypeLoc();
+  TemplateSpecializationTypeLoc Specialization =
+      TL.getAs<TemplateSpecializationTypeLoc>();
+  if (!Specialization || Specialization.getNumArgs() != 1)
+    return false;
+  SourceRange Range = Full.getSourceRange();
+  if (Range.getBegin().isMacroID() || Range.getEnd().isMacroID())
+    return false;
+  StringRef Element = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(
+          Specialization.getArgLoc(0).getSourceRange()),
+      SM, LangOpts);
+  if (Element.empty())
+    return false;
+  Fixes.push_back(FixItHint::CreateReplacement(
+      CharSourceRange::getTokenRange(Range),
+      ("llvm::SmallVector<" + Element + ", " + llvm::Twine(N) + ">").str()));
+  return true;
+}
+
+void PreferSmallVectorCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Var = Result.Nodes.getNodeAs<VarDecl>("var");
+  if (!Var->isLocalVarDecl() || !Var->hasLocalStorage() ||
+      isa<ParmVarDecl>(Var) || Var->getLocation().isMacroID())
+    return;
+  const auto *Vector = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      Var->getType()->getAsCXXRecordDecl());
+  if (!Vector || Vector->getQualifiedNameAsString() != "std::vector" ||
+      Vector->getTemplateArgs().size() < 1 ||
+      Vector->getTemplateArgs()[0].getKind() != TemplateArgument::Type ||
+      Vector->getTemplateArgs()[0].getAsType()->isBooleanType())
+    return;
+  const auto *Function =
+      dyn_cast_or_null<FunctionDecl>(Var->getParentFunctionOrMethod());
+  if (!Function || !Function->getBody() || Function->isTemplateInstantiation())
+    return;
+
+  ASTContext &Context = *Result.Context;
+  int64_t Limit = MaxElements;
+  int64_t Bound = getInitialSize(*Var, Context);
+  if (Bound < 0 || Bound > Limit)
+    return;
+
+  const Stmt *Body = Function->getBody();
+  SmallVector<const DeclRefExpr *, 8> Refs;
+  VarRefCollector(*Var, Refs).TraverseStmt(const_cast<Stmt *>(Body));
+  ParentMap Parents(const_cast<Stmt *>(Body));
+  bool Fixable = true;
+  for (const DeclRefExpr *Ref : Refs) {
+    int64_t Added =
+        getAddedElements(*Ref, Body, Parents, Context, Limit, Fixable);
+    if (Added < 0)
+      return;
+    Bound += Added;
+    if (Bound > Limit)
+      return;
+  }
+  // Vectors that stay empty don't allocate.
+  if (Bound == 0)
+    return;
+
+  QualType Element = Vector->getTemplateArgs()[0].getAsType();
+  DiagnosticBuilder Diag =
+      diag(Var->getLocation(),
+           "%0 holds at most %1 elements; consider 'llvm::SmallVector<%2, %1>' "
+           "to avoid allocating them on the heap")
+      << Var << static_cast<unsigned>(Bound)
+      << Element.getAsString(Context.getPrintingPolicy());
+  SmallVector<FixItHint, 1> Fixes;
+  if (Fixable && makeSmallVectorFix(*Var, Bound, *Result.SourceManager,
+                         Context.getLangOpts(), Fixes))
+    Diag << Fixes[0];
+}
+
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,49 @@
+//===--- PreferSmallVectorCheck.h - clang-tidy ------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_SMALL_VECTOR_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_SMALL_VECTOR_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+
+/// \brief Finds local \c std::vectors that never hold more than a small,
+/// statically known number of elements and suggests \c llvm::SmallVector,
+/// which keeps them on the stack.
+///
+/// Example:
+/// \code
+///   std::vector<Value *> Ops;              ==>   llvm::SmallVector<Value *, 3>
+///   for (unsigned I = 0; I != 3; ++I)
+///     Ops.push_back(getOperand(I));
+/// \endcode
+///
+/// The upper bound on the size is the number of elements of the initializer
+/// plus the number of \c push_back and \c emplace_back calls, each multiplied
+/// by the trip counts of the enclosing loops, which must be constant. Vectors
+/// are only reported if every other use is a member function \c SmallVector
+/// provides as well, a subscript or a range-for loop, and the bound doesn't
+/// exceed the "MaxElements" option (16 by default).
+class PreferSmallVectorCheck : public ClangTidyCheck {
+public:
+  PreferSmallVectorCheck();
+
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  unsigned MaxElements;
+};
+
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_LLVM_PREFER_SMALL_VECTOR_CHECK_H
@@ -0,0 +1,229 @@
+//===--- AllocationInLoopCheck.cpp - clang-tidy ---------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AllocationInLoopCheck.h"
+#include "DeclRefExprUtils.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void AllocationInLoopCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(
+      stmt(anyOf(forStmt(), forRangeStmt(), whileStmt(), doStmt()),
+           unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("loop"),
+      this);
+}
+
+namespace {
+enum AllocationKind {
+  AK_None,
+  /// \brief A container whose storage can be reused after \c clear().
+  AK_Container,
+  /// \brief A \c std::unique_ptr owning a new object.
+  AK_UniquePtr,
+  /// \brief A raw pointer initialized by a new-expression.
+  AK_RawPointer
+};
+} // namespace
+
+static const Stmt *getLoopBody(const Stmt *Loop) {
+  if (const auto *For = dyn_cast<ForStmt>(Loop))
+    return For->getBody();
+  if (const auto *ForRange = dyn_cast<CXXForRangeStmt>(Loop))
+    return ForRange->getBody();
+  if (const auto *While = dyn_cast<WhileStmt>(Loop))
+    return While->getBody();
+  return cast<DoStmt>(Loop)->getBody();
+}
+
+static std::string getRecordName(QualType Type) {
+  const CXXRecordDecl *Record = Type->getAsCXXRecordDecl();
+  return Record ? Record->getQualifiedNameAsString() : std::string();
+}
+
+/// \brief Whether \p Init creates the object with \c std::make_unique or
+/// \c new.
+static bool isHeapAllocation(const Expr *Init) {
+  Init = Init->IgnoreImplicit();
+  // 'auto P = std::make_unique<T>()' moves from the temporary.
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(Init)) {
+    if (Construct->getNumArgs() == 0)
+      return false;
+    Init = Construct->getArg(0)->IgnoreImplicit();
+  }
+  if (isa<CXXNewExpr>(Init->IgnoreParenImpCasts()))
+    return true;
+  const auto *Call = dyn_cast<CallExpr>(Init);
+  const FunctionDecl *Callee = Call ? Call->getDirectCallee() : nullptr;
+  return Callee && Callee->getQualifiedNameAsString() == "std::make_unique";
+}
+
+static AllocationKind getAllocationKind(const VarDecl &Var) {
+  const Expr *Init = Var.getInit();
+  if (!Init || !Var.hasLocalStorage() || isa<ParmVarDecl>(Var))
+    return AK_None;
+  QualType Type = Var.getType();
+  if (Type->isPointerType())
+    return isa<CXXNewExpr>(Init->IgnoreParenImpCasts()) ? AK_RawPointer
+                                                        : AK_None;
+  std::string Name = getRecordName(Type);
+  if (Name == "std::unique_ptr")
+    return isHeapAllocation(Init) ? AK_UniquePtr : AK_None;
+  // Node-based containers free their nodes in clear(), reusing them doesn't
+  // save allocations.
+  if (Name == "std::vector" || Name == "std::basic_string" ||
+      Name == "std::deque" || Name == "std::unordered_map" ||
+      Name == "std::unordered_set")
+    return AK_Container;
+  return AK_None;
+}
+
+/// \brief Whether the container \p Var is constructed with contents, rather
+/// than empty.
+///
+/// Containers copied or moved from a returned temporary take over its
+/// storage, assigning the temporary to a hoisted container wouldn't save an
+/// allocation.
+static bool isConstructedNonEmpty(const VarDecl &Var) {
+  const auto *Construct =
+      dyn_cast<CXXConstructExpr>(Var.getInit()->IgnoreImplicit());
+  if (!Construct)
+    return true;
+  if (Construct->getNumArgs() == 0 ||
+      isa<CXXDefaultArgExpr>(Construct->getArg(0)))
+    return false;
+  if (Construct->getConstructor()->isCopyOrMoveConstructor()) {
+    const auto *Call =
+        dyn_cast<CallExpr>(Construct->getArg(0)->IgnoreImplicit());
+    if (Call && Call->isRValue())
+      return false;
+  }
+  return true;
+}
+
+/// \brief Whether the use \p Ref lets the memory owned by the variable outlive
+/// the iteration: returning it, moving or swapping it out, releasing it, or
+/// copying a raw owning pointer.
+static bool escapes(const DeclRefExpr &Ref, AllocationKind Kind,
+                    const ParentMap &Parents, bool &IsDeleted) {
+  const Stmt *Child = &Ref;
+  const Stmt *Parent = Parents.getParent(Child);
+  // Returning copies or moves the variable into the return value.
+  while (Parent && (isa<ParenExpr>(Parent) || isa<ImplicitCastExpr>(Parent) ||
+                    isa<CXXConstructExpr>(Parent) ||
+                    isa<ExprWithCleanups>(Parent))) {
+    Child = Parent;
+    Parent = Parents.getParent(Child);
+  }
+  if (!Parent)
+    return false;
+
+  if (isa<ReturnStmt>(Parent))
+    return true;
+  if (const auto *Delete = dyn_cast<CXXDeleteExpr>(Parent)) {
+    if (Delete->getArgument() == Child)
+      IsDeleted = true;
+    return false;
+  }
+  if (const auto *Member = dyn_cast<MemberExpr>(Parent)) {
+    const ValueDecl *MemberDecl = Member->getMemberDecl();
+    return MemberDecl->getIdentifier() &&
+           (MemberDecl->getName() == "swap" ||
+            MemberDecl->getName() == "release");
+  }
+  if (isa<CallExpr>(Parent) && !isa<CXXOperatorCallExpr>(Parent)) {
+    const FunctionDecl *Callee = cast<CallExpr>(Parent)->getDirectCallee();
+    if (Callee && Callee->getIdentifier() &&
+        (Callee->getName() == "move" || Callee->getName() == "forward" ||
+         Callee->getName() == "swap"))
+      return true;
+  }
+  if (Kind != AK_RawPointer)
+    return false;
+  // Copies of an owning raw pointer may be deleted elsewhere.
+  if (const auto *BinOp = dyn_cast<BinaryOperator>(Parent))
+    return BinOp->isAssignmentOp() && BinOp->getRHS() == Child;
+  return isa<DeclStmt>(Parent) || isa<InitListExpr>(Parent);
+}
+
+void AllocationInLoopCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Loop = Result.Nodes.getNodeAs<Stmt>("loop");
+  const auto *Body = dyn_cast_or_null<CompoundStmt>(getLoopBody(Loop));
+  if (!Body || Loop->getLocStart().isMacroID())
+    return;
+
+  ParentMap Parents(const_cast<CompoundStmt *>(Body));
+  for (CompoundStmt::const_body_iterator I = Body->body_begin(),
+                                         E = Body->body_end();
+       I != E; ++I) {
+    const auto *DS = dyn_cast<DeclStmt>(*I);
+    if (!DS)
+      continue;
+    for (DeclStmt::const_decl_iterator DI = DS->decl_begin(),
+                                       DE = DS->decl_end();
+         DI != DE; ++DI) {
+      const auto *Var = dyn_cast<VarDecl>(*DI);
+      if (!Var || Var->getLocation().isMacroID())
+        continue;
+      AllocationKind Kind = getAllocationKind(*Var);
+      if (Kind == AK_None)
+        continue;
+
+      llvm::SmallVector<const DeclRefExpr *, 8> Refs;
+      collectDeclRefs(*Var, *Body, Refs);
+      bool Escapes = false;
+      bool IsDeleted = false;
+      bool IsModified = false;
+      for (const DeclRefExpr *Ref : Refs) {
+        if (escapes(*Ref, Kind, Parents, IsDeleted)) {
+          Escapes = true;
+          break;
+        }
+        if (!isConstUse(*Ref, Parents))
+          IsModified = true;
+      }
+      if (Escapes)
+        continue;
+
+      if (Kind == AK_Container) {
+        // An empty container that is never filled doesn't allocate.
+        if (!IsModified && !isConstructedNonEmpty(*Var))
+          continue;
+        diag(Var->getLocation(),
+             "%0 allocates memory that is freed at the end of every loop "
+             "iteration; consider declaring it before the loop and clearing "
+             "it in each iteration to reuse its storage")
+            << Var;
+        continue;
+      }
+      // Without the delete the raw pointer leaks or is owned elsewhere.
+      if (Kind == AK_RawPointer && !IsDeleted)
+        continue;
+      diag(Var->getLocation(),
+           "the object owned by %0 is allocated and freed in every loop "
+           "iteration; consider allocating it once before the loop and "
+           "reusing it")
+          << Var;
+    }
+  }
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,46 @@
+//===--- AllocationInLoopCheck.h - clang-tidy -------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_ALLOCATION_IN_LOOP_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_ALLOCATION_IN_LOOP_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds heap-owning local variables declared in a loop body whose
+/// memory is allocated and freed in every iteration.
+///
+/// Example:
+/// \code
+///   for (const Item &I : Items) {
+///     std::vector<int> Scratch;    // allocates in every iteration
+///     fill(Scratch, I);
+///     consume(Scratch);
+///   }
+/// \endcode
+///
+/// Reports containers that are filled or constructed with contents,
+/// \c std::unique_ptr initialized by \c std::make_unique or \c new, and raw
+/// pointers initialized by \c new and deleted in the same body. Variables that
+/// are moved out, swapped, released or returned are not reported, as their
+/// memory outlives the iteration.
+class AllocationInLoopCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_ALLOCATION_IN_LOOP_CHECK_H
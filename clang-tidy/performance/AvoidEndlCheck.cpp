@@ -0,0 +1,60 @@
+//===--- AvoidEndlCheck.cpp - clang-tidy ----------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AvoidEndlCheck.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+AvoidEndlCheck::AvoidEndlCheck() : StrictMode(false) {}
+
+void AvoidEndlCheck::registerMatchers(MatchFinder *Finder) {
+  StrictMode = getOption("StrictMode", 0u) != 0;
+
+  // 'Stream << std::endl' passes a pointer to the function template
+  // specialization to the stream's operator<<.
+  const auto EndlArgument =
+      declRefExpr(to(functionDecl(hasName("::std::endl"))),
+                  hasParent(implicitCastExpr(hasParent(operatorCallExpr(
+                      hasOverloadedOperatorName("<<"))))),
+                  unless(hasAncestor(functionDecl(isInstantiatedFunction()))));
+  const auto InLoop = hasAncestor(
+      stmt(anyOf(forStmt(), forRangeStmt(), whileStmt(), doStmt())));
+
+  if (StrictMode)
+    Finder->addMatcher(EndlArgument.bind("endl"), this);
+  else
+    Finder->addMatcher(declRefExpr(EndlArgument, InLoop).bind("endl"), this);
+}
+
+void AvoidEndlCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Endl = Result.Nodes.getNodeAs<DeclRefExpr>("endl");
+  SourceRange Range = Endl->getSourceRange();
+  if (Range.getBegin().isMacroID() || Range.getEnd().isMacroID())
+    return;
+
+  diag(Range.getBegin(),
+       StrictMode ? "'std::endl' flushes the stream; use '\\n' instead unless "
+                    "the flush is needed"
+                  : "'std::endl' inside a loop flushes the stream on every "
+                    "iteration; use '\\n' instead")
+      << FixItHint::CreateReplacement(
+             CharSourceRange::getTokenRange(Range), "'\\n'");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
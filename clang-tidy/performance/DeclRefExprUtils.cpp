@@ -0,0 +1,171 @@
+//===--- DeclRefExprUtils.cpp - clang-tidy --------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "DeclRefExprUtils.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+namespace {
+/// \brief \c RecursiveASTVisitor collecting all references to a variable.
+class DeclRefCollector : public RecursiveASTVisitor<DeclRefCollector> {
+public:
+  DeclRefCollector(const VarDecl &Var,
+                   llvm::SmallVectorImpl<const DeclRefExpr *> &Refs)
+      : Var(Var), Refs(Refs) {}
+
+  bool VisitDeclRefExpr(DeclRefExpr *E) {
+    if (E->getDecl() == &Var)
+      Refs.push_back(E);
+    return true;
+  }
+
+private:
+  const VarDecl &Var;
+  llvm::SmallVectorImpl<const DeclRefExpr *> &Refs;
+};
+} // namespace
+
+static bool isConstReferenceType(QualType Type) {
+  return Type->isLValueReferenceType() &&
+         Type->getPointeeType().isConstQualified();
+}
+
+/// \brief Whether an argument bound to parameter \p ParamIndex of \p Callee
+/// can be modified by the call.
+static bool isConstParam(const FunctionDecl *Callee, unsigned ParamIndex) {
+  if (!Callee || ParamIndex >= Callee->getNumParams())
+    return false;
+  QualType ParamType = Callee->getParamDecl(ParamIndex)->getType();
+  return !ParamType->isReferenceType() || isConstReferenceType(ParamType);
+}
+
+template <typename CallT>
+static bool findArgument(const CallT &Call, const Stmt *Arg, unsigned &Index) {
+  for (unsigned I = 0, E = Call.getNumArgs(); I != E; ++I) {
+    if (Call.getArg(I) == Arg) {
+      Index = I;
+      return true;
+    }
+  }
+  return false;
+}
+
+void collectDeclRefs(const VarDecl &Var, const Stmt &S,
+                     llvm::SmallVectorImpl<const DeclRefExpr *> &Refs) {
+  DeclRefCollector Collector(Var, Refs);
+  Collector.TraverseStmt(const_cast<Stmt *>(&S));
+}
+
+bool isConstUse(const Expr &E, const ParentMap &Parents) {
+  const Stmt *Child = &E;
+  const Stmt *Parent = Parents.getParent(Child);
+
+  // Look through parentheses and conversions that only add qualifiers or
+  // convert to a base class; neither changes what the use can do.
+  while (Parent) {
+    if (const auto *Cast = dyn_cast<ImplicitCastExpr>(Parent)) {
+      if (Cast->getCastKind() != CK_NoOp &&
+          Cast->getCastKind() != CK_DerivedToBase &&
+          Cast->getCastKind() != CK_UncheckedDerivedToBase)
+        break;
+    } else if (!isa<ParenExpr>(Parent)) {
+      break;
+    }
+    Child = Parent;
+    Parent = Parents.getParent(Child);
+  }
+  if (!Parent)
+    return false;
+
+  if (const auto *Cast = dyn_cast<ImplicitCastExpr>(Parent))
+    return Cast->getCastKind() == CK_LValueToRValue;
+
+  if (const auto *Member = dyn_cast<MemberExpr>(Parent)) {
+    const ValueDecl *MemberDecl = Member->getMemberDecl();
+    if (const auto *Method = dyn_cast<CXXMethodDecl>(MemberDecl))
+      return Method->isConst() || Method->isStatic();
+    if (isa<FieldDecl>(MemberDecl))
+      return isConstUse(*Member, Parents);
+    // Static data members don't depend on the object.
+    return isa<VarDecl>(MemberDecl);
+  }
+
+  unsigned Index;
+  if (const auto *OpCall = dyn_cast<CXXOperatorCallExpr>(Parent)) {
+    if (!findArgument(*OpCall, Child, Index))
+      return false;
+    const FunctionDecl *Callee = OpCall->getDirectCallee();
+    if (const auto *Method = dyn_cast_or_null<CXXMethodDecl>(Callee)) {
+      // The object argument of a member operator is passed implicitly.
+      if (Index == 0)
+        return Method->isConst();
+      return isConstParam(Method, Index - 1);
+    }
+    return isConstParam(Callee, Index);
+  }
+
+  if (const auto *Call = dyn_cast<CallExpr>(Parent))
+    return findArgument(*Call, Child, Index) &&
+           isConstParam(Call->getDirectCallee(), Index);
+
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(Parent))
+    return findArgument(*Construct, Child, Index) &&
+           isConstParam(Construct->getConstructor(), Index);
+
+  if (const auto *DS = dyn_cast<DeclStmt>(Parent)) {
+    for (DeclStmt::const_decl_iterator I = DS->decl_begin(),
+                                       E = DS->decl_end();
+         I != E; ++I) {
+      const auto *Bound = dyn_cast<VarDecl>(*I);
+      if (!Bound || Bound->getInit() != Child)
+        continue;
+      if (isConstReferenceType(Bound->getType()))
+        return true;
+      // 'for (const T &X : Range)' binds the range to an implicit 'auto &&'
+      // variable; iterating never modifies the range unless the loop variable
+      // is a non-const reference.
+      if (const auto *ForRange =
+              dyn_cast_or_null<CXXForRangeStmt>(Parents.getParent(DS))) {
+        if (ForRange->getRangeStmt() == DS) {
+          QualType LoopVarType = ForRange->getLoopVariable()->getType();
+          return !LoopVarType->isReferenceType() ||
+                 isConstReferenceType(LoopVarType);
+        }
+      }
+      return false;
+    }
+  }
+
+  return false;
+}
+
+bool isOnlyUsedAsConst(const VarDecl &Var, const Stmt &S) {
+  llvm::SmallVector<const DeclRefExpr *, 8> Refs;
+  collectDeclRefs(Var, S, Refs);
+  if (Refs.empty())
+    return true;
+
+  ParentMap Parents(const_cast<Stmt *>(&S));
+  for (const DeclRefExpr *Ref : Refs) {
+    if (!isConstUse(*Ref, Parents))
+      return false;
+  }
+  return true;
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,47 @@
+//===--- DeclRefExprUtils.h - clang-tidy ------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_DECL_REF_EXPR_UTILS_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_DECL_REF_EXPR_UTILS_H
+
+#include "clang/AST/Expr.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace clang {
+class ParentMap;
+class Stmt;
+class VarDecl;
+
+namespace tidy {
+namespace performance {
+
+/// \brief Collects all \c DeclRefExprs referring to \p Var within \p S.
+void collectDeclRefs(const VarDecl &Var, const Stmt &S,
+                     llvm::SmallVectorImpl<const DeclRefExpr *> &Refs);
+
+/// \brief Returns \c true if the value of \p E can't be modified by the
+/// expression that uses it, i.e. the code would still compile and behave the
+/// same if \p E had const-qualified type.
+///
+/// \p Parents must be built from a statement containing \p E.
+///
+/// The analysis is conservative: every use it doesn't understand (taking the
+/// address, binding to a non-const reference, calling a non-const method,
+/// calling through an unknown callee, ...) counts as a modification.
+bool isConstUse(const Expr &E, const ParentMap &Parents);
+
+/// \brief Returns \c true if every reference to \p Var within \p S is a
+/// \c isConstUse().
+bool isOnlyUsedAsConst(const VarDecl &Var, const Stmt &S);
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_DECL_REF_EXPR_UTILS_H
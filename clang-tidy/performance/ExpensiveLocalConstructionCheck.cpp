@@ -0,0 +1,132 @@
+//===--- ExpensiveLocalConstructionCheck.cpp - clang-tidy -----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExpensiveLocalConstructionCheck.h"
+#include "DeclRefExprUtils.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "llvm/ADT/SmallVector.h"
+#include <algorithm>
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void ExpensiveLocalConstructionCheck::registerMatchers(MatchFinder *Finder) {
+  std::string TypeList =
+      getOption("ExpensiveTypes", "std::basic_regex;std::locale;std::map;"
+                                  "std::set;std::unordered_map;"
+                                  "std::unordered_set");
+  SmallVector<StringRef, 8> Types;
+  StringRef(TypeList).split(Types, ";", -1, /*KeepEmpty=*/false);
+  ExpensiveTypes.assign(Types.begin(), Types.end());
+
+  Finder->addMatcher(
+      varDecl(hasAncestor(functionDecl()),
+              unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("var"),
+      this);
+}
+
+/// \brief Whether \p E only depends on literals and constants, so that it
+/// computes the same value in every call.
+static bool isBuiltFromConstants(const Expr *E, ASTContext &Context) {
+  E = E->IgnoreParenImpCasts();
+  if (isa<StringLiteral>(E) || isa<CXXDefaultArgExpr>(E))
+    return true;
+  if (const auto *Ref = dyn_cast<DeclRefExpr>(E)) {
+    const auto *Var = dyn_cast<VarDecl>(Ref->getDecl());
+    if (Var && Var->hasGlobalStorage() && Var->getType().isConstQualified())
+      return true;
+  }
+  if (E->getType()->isScalarType())
+    return E->isEvaluatable(Context);
+  if (const auto *Temp = dyn_cast<MaterializeTemporaryExpr>(E))
+    return isBuiltFromConstants(Temp->GetTemporaryExpr(), Context);
+  if (const auto *Bind = dyn_cast<CXXBindTemporaryExpr>(E))
+    return isBuiltFromConstants(Bind->getSubExpr(), Context);
+  if (const auto *Cleanups = dyn_cast<ExprWithCleanups>(E))
+    return isBuiltFromConstants(Cleanups->getSubExpr(), Context);
+  if (const auto *Cast = dyn_cast<ExplicitCastExpr>(E))
+    return isBuiltFromConstants(Cast->getSubExpr(), Context);
+  if (const auto *List = dyn_cast<CXXStdInitializerListExpr>(E))
+    return isBuiltFromConstants(List->getSubExpr(), Context);
+  if (const auto *List = dyn_cast<InitListExpr>(E)) {
+    for (unsigned I = 0, N = List->getNumInits(); I != N; ++I) {
+      if (!isBuiltFromConstants(List->getInit(I), Context))
+        return false;
+    }
+    return true;
+  }
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(E)) {
+    for (unsigned I = 0, N = Construct->getNumArgs(); I != N; ++I) {
+      if (!isBuiltFromConstants(Construct->getArg(I), Context))
+        return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+void ExpensiveLocalConstructionCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  const auto *Var = Result.Nodes.getNodeAs<VarDecl>("var");
+  if (isa<ParmVarDecl>(Var) || !Var->isLocalVarDecl() ||
+      !Var->hasLocalStorage() || Var->getLocation().isMacroID())
+    return;
+  const CXXRecordDecl *Record = Var->getType()->getAsCXXRecordDecl();
+  if (!Record)
+    return;
+  std::string TypeName = Record->getQualifiedNameAsString();
+  if (std::find(ExpensiveTypes.begin(), ExpensiveTypes.end(), TypeName) ==
+      ExpensiveTypes.end())
+    return;
+
+  // Default-constructed objects are usually filled in later, or are cheap.
+  const Expr *Init = Var->getInit();
+  if (!Init)
+    return;
+  const auto *Construct = dyn_cast<CXXConstructExpr>(Init->IgnoreImplicit());
+  if (!Construct || Construct->getNumArgs() == 0 ||
+      isa<CXXDefaultArgExpr>(Construct->getArg(0)) ||
+      !isBuiltFromConstants(Construct, *Result.Context))
+    return;
+
+  // Statics aren't allowed in constexpr functions.
+  const auto *Function =
+      dyn_cast_or_null<FunctionDecl>(Var->getParentFunctionOrMethod());
+  if (!Function || !Function->getBody() || Function->isConstexpr() ||
+      !isOnlyUsedAsConst(*Var, *Function->getBody()))
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(Var->getLocation(),
+           "%0 of type %1 is constructed from constants in every call; "
+           "consider making it a function-local static or a namespace-scope "
+           "constant")
+      << Var << Var->getType();
+  SourceLocation Begin = Var->getLocStart();
+  if (Begin.isMacroID())
+    return;
+  // A declaration with several variables would make all of them static.
+  auto Parents = Result.Context->getParents(*Var);
+  const DeclStmt *DS = Parents.empty() ? nullptr : Parents[0].get<DeclStmt>();
+  if (!DS || !DS->isSingleDecl())
+    return;
+  Diag << FixItHint::CreateInsertion(
+      Begin, Var->getType().isConstQualified() ? "static " : "static const ");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,50 @@
+//===--- ExpensiveLocalConstructionCheck.h - clang-tidy ---------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_EXPENSIVE_LOCAL_CONSTRUCTION_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_EXPENSIVE_LOCAL_CONSTRUCTION_CHECK_H
+
+#include "../ClangTidy.h"
+#include <string>
+#include <vector>
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds local variables of expensive-to-construct types that are
+/// built only from constants and never modified, so every call of the
+/// function constructs the same object again.
+///
+/// Example:
+/// \code
+///   bool isId(const std::string &S) {
+///     std::regex Id("[a-z]+");          ==>   static const std::regex Id(...);
+///     return std::regex_match(S, Id);
+///   }
+/// \endcode
+///
+/// The expensive types are configured with the "ExpensiveTypes" option, a
+/// semicolon-separated list of qualified class names. It defaults to
+/// "std::basic_regex;std::locale;std::map;std::set;std::unordered_map;
+/// std::unordered_set".
+class ExpensiveLocalConstructionCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  std::vector<std::string> ExpensiveTypes;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_EXPENSIVE_LOCAL_CONSTRUCTION_CHECK_H
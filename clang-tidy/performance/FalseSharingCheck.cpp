@@ -0,0 +1,112 @@
+//===--- FalseSharingCheck.cpp - clang-tidy -------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FalseSharingCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/RecordLayout.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+FalseSharingCheck::FalseSharingCheck() : CacheLineSize(64) {}
+
+void FalseSharingCheck::registerMatchers(MatchFinder *Finder) {
+  CacheLineSize = getOption("CacheLineSize", CacheLineSize);
+  if (CacheLineSize == 0)
+    return;
+  Finder->addMatcher(recordDecl().bind("record"), this);
+}
+
+/// \brief Whether \p Type is an atomic or a mutex, i.e. an object that
+/// threads write to without other synchronization.
+static bool isSynchronizationType(QualType Type) {
+  Type = Type.getCanonicalType();
+  if (Type->isAtomicType())
+    return true;
+  const CXXRecordDecl *Record = Type->getAsCXXRecordDecl();
+  if (!Record)
+    return false;
+  std::string Name = Record->getQualifiedNameAsString();
+  return Name == "std::atomic" || Name == "std::atomic_flag" ||
+         Name == "std::mutex" || Name == "std::recursive_mutex" ||
+         Name == "std::timed_mutex" || Name == "std::recursive_timed_mutex" ||
+         Name == "std::shared_timed_mutex" || Name == "std::shared_mutex";
+}
+
+void FalseSharingCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Record = Result.Nodes.getNodeAs<RecordDecl>("record");
+  if (!Record->isThisDeclarationADefinition() || Record->isInvalidDecl() ||
+      Record->isImplicit() || Record->isUnion() || Record->isDependentType() ||
+      isa<ClassTemplateSpecializationDecl>(Record) ||
+      Record->getLocation().isInvalid() ||
+      Result.SourceManager->isInSystemHeader(Record->getLocation()))
+    return;
+
+  ASTContext &Context = *Result.Context;
+  const ASTRecordLayout &Layout = Context.getASTRecordLayout(Record);
+  // Unless the record itself starts a cache line, any two fields closer than
+  // a cache line may end up on the same one.
+  bool IsLineAligned =
+      Layout.getAlignment().getQuantity() % CacheLineSize == 0;
+
+  const FieldDecl *Previous = nullptr;
+  // One past the last byte of the previous synchronization field.
+  uint64_t PreviousEnd = 0;
+  for (RecordDecl::field_iterator I = Record->field_begin(),
+                                  E = Record->field_end();
+       I != E; ++I) {
+    QualType Type = I->getType();
+    const ConstantArrayType *Array = Context.getAsConstantArrayType(Type);
+    if (Array)
+      Type = Context.getBaseElementType(Array);
+    if (I->isBitField() || !isSynchronizationType(Type))
+      continue;
+
+    uint64_t Offset =
+        Context.toCharUnitsFromBits(Layout.getFieldOffset(I->getFieldIndex()))
+            .getQuantity();
+    uint64_t Size = Context.getTypeSizeInChars(Type).getQuantity();
+    if (Array && Array->getSize().ugt(1) && Size < CacheLineSize) {
+      diag(I->getLocation(),
+           "elements of %0 share %1-byte cache lines; writes to different "
+           "elements from different threads cause false sharing; consider "
+           "wrapping the element type in a struct aligned with 'alignas(%1)'")
+          << *I << CacheLineSize;
+    }
+
+    // The previous field may end within the line this one starts in, or, if
+    // the record isn't aligned, they may be close enough to share one.
+    if (Previous) {
+      bool SameLine = IsLineAligned
+                          ? (PreviousEnd - 1) / CacheLineSize ==
+                                Offset / CacheLineSize
+                          : Offset - PreviousEnd + 1 < CacheLineSize;
+      if (SameLine) {
+        diag(I->getLocation(),
+             "%0 may share a %2-byte cache line with %1; writes to them from "
+             "different threads cause false sharing; consider aligning %0 "
+             "with 'alignas(%2)' or inserting padding")
+            << *I << Previous << CacheLineSize;
+      }
+    }
+    Previous = *I;
+    PreviousEnd =
+        Offset + Context.getTypeSizeInChars(I->getType()).getQuantity();
+  }
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
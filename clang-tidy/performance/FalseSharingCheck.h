@@ -0,0 +1,51 @@
+//===--- FalseSharingCheck.h - clang-tidy -----------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FALSE_SHARING_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FALSE_SHARING_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds atomic and mutex fields that may share a cache line with
+/// another atomic or mutex field of the same record.
+///
+/// Such fields are usually written by different threads; when they share a
+/// cache line, every write invalidates the line in the other cores' caches.
+///
+/// Example:
+/// \code
+///   struct Stats {
+///     std::atomic<long> Hits;
+///     std::atomic<long> Misses;   // warning: shares a cache line with Hits
+///   };
+/// \endcode
+///
+/// Arrays of atomics or mutexes smaller than a cache line are reported as
+/// well. The cache line size is set by the "CacheLineSize" option (in bytes,
+/// 64 by default).
+class FalseSharingCheck : public ClangTidyCheck {
+public:
+  FalseSharingCheck();
+
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  unsigned CacheLineSize;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FALSE_SHARING_CHECK_H
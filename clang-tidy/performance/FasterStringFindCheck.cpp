@@ -0,0 +1,103 @@
+//===--- FasterStringFindCheck.cpp - clang-tidy ---------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FasterStringFindCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Twine.h"
+#include <algorithm>
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void FasterStringFindCheck::registerMatchers(MatchFinder *Finder) {
+  std::string ClassList =
+      getOption("StringLikeClasses", "std::basic_string;llvm::StringRef");
+  SmallVector<StringRef, 4> Classes;
+  StringRef(ClassList).split(Classes, ";", -1, /*KeepEmpty=*/false);
+  StringLikeClasses.assign(Classes.begin(), Classes.end());
+
+  Finder->addMatcher(
+      memberCallExpr(
+          callee(methodDecl(anyOf(
+              hasName("find"), hasName("rfind"), hasName("find_first_of"),
+              hasName("find_last_of"), hasName("find_first_not_of"),
+              hasName("find_last_not_of")))),
+          anyOf(argumentCountIs(1), argumentCountIs(2))).bind("call"),
+      this);
+}
+
+/// \brief Returns the string literal \p Arg was converted from, looking
+/// through array decay and implicit conversions to string-like classes.
+static const StringLiteral *getStringLiteralArgument(const Expr *Arg) {
+  Arg = Arg->IgnoreImplicit();
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(Arg)) {
+    if (Construct->getNumArgs() != 1)
+      return nullptr;
+    Arg = Construct->getArg(0)->IgnoreImplicit();
+  }
+  return dyn_cast<StringLiteral>(Arg->IgnoreParenImpCasts());
+}
+
+/// \brief Turns the spelling of a one-character string literal into the
+/// spelling of the equivalent character literal.
+static std::string makeCharacterLiteral(StringRef StringSpelling) {
+  StringRef Contents = StringSpelling.drop_front().drop_back();
+  if (Contents == "'")
+    return "'\\''";
+  if (Contents == "\\\"")
+    return "'\"'";
+  return ("'" + Contents + "'").str();
+}
+
+void FasterStringFindCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Call = Result.Nodes.getNodeAs<CXXMemberCallExpr>("call");
+  const CXXMethodDecl *Method = Call->getMethodDecl();
+  if (!Method || Method->getNumParams() < 1 ||
+      Method->getParamDecl(0)->getType()->isCharType())
+    return;
+
+  std::string ClassName = Method->getParent()->getQualifiedNameAsString();
+  if (std::find(StringLikeClasses.begin(), StringLikeClasses.end(),
+                ClassName) == StringLikeClasses.end())
+    return;
+
+  // "\0" is the empty string as a 'const char *', but '\0' is a character
+  // that may be found.
+  const StringLiteral *Literal = getStringLiteralArgument(Call->getArg(0));
+  if (!Literal || !Literal->isAscii() || Literal->getLength() != 1 ||
+      Literal->getCodeUnit(0) == 0 || Literal->getNumConcatenated() != 1 ||
+      Literal->getLocStart().isMacroID())
+    return;
+
+  CharSourceRange LiteralRange =
+      CharSourceRange::getTokenRange(Literal->getSourceRange());
+  StringRef Spelling = Lexer::getSourceText(
+      LiteralRange, *Result.SourceManager, Result.Context->getLangOpts());
+  // Raw and prefixed literals are left alone.
+  if (!Spelling.startswith("\"") || !Spelling.endswith("\""))
+    return;
+
+  diag(Literal->getLocStart(),
+       "%0 called with a string literal consisting of a single character; "
+       "consider using the more efficient overload accepting a character")
+      << Method
+      << FixItHint::CreateReplacement(LiteralRange,
+                                      makeCharacterLiteral(Spelling));
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
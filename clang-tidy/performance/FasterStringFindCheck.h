@@ -0,0 +1,46 @@
+//===--- FasterStringFindCheck.h - clang-tidy -------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FASTER_STRING_FIND_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FASTER_STRING_FIND_CHECK_H
+
+#include "../ClangTidy.h"
+#include <string>
+#include <vector>
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds calls to string search members with a single-character string
+/// literal and replaces the literal with a character literal, so that the
+/// cheaper character overload is used.
+///
+/// Example:
+/// \code
+///   S.find("x")  ==>  S.find('x')
+/// \endcode
+///
+/// The searched classes are configured with the "StringLikeClasses" option, a
+/// semicolon-separated list of qualified class names. It defaults to
+/// "std::basic_string;llvm::StringRef".
+class FasterStringFindCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  std::vector<std::string> StringLikeClasses;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FASTER_STRING_FIND_CHECK_H
@@ -0,0 +1,67 @@
+//===--- ForRangeCopyCheck.cpp - clang-tidy -------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ForRangeCopyCheck.h"
+#include "DeclRefExprUtils.h"
+#include "TypeTraits.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void ForRangeCopyCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(forRangeStmt().bind("forRange"), this);
+}
+
+void ForRangeCopyCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *ForRange = Result.Nodes.getNodeAs<CXXForRangeStmt>("forRange");
+  const VarDecl *LoopVar = ForRange->getLoopVariable();
+  if (!LoopVar || LoopVar->getLocation().isMacroID() ||
+      isInTemplateInstantiation(*LoopVar))
+    return;
+
+  QualType Type = LoopVar->getType();
+  if (Type->isReferenceType() || !isExpensiveToCopy(Type, *Result.Context))
+    return;
+
+  // Only a copy of an existing element can be avoided. If dereferencing the
+  // iterator already yields a temporary, binding a reference to it saves
+  // nothing.
+  const auto *Construct =
+      dyn_cast_or_null<CXXConstructExpr>(LoopVar->getInit()->IgnoreImplicit());
+  if (!Construct || Construct->getNumArgs() < 1 ||
+      !Construct->getConstructor()->isCopyConstructor() ||
+      isa<MaterializeTemporaryExpr>(
+          Construct->getArg(0)->IgnoreParenImpCasts()))
+    return;
+
+  if (!isOnlyUsedAsConst(*LoopVar, *ForRange->getBody()))
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(LoopVar->getLocation(),
+           "loop variable %0 is copied in each iteration but only read; "
+           "consider making it a const reference")
+      << LoopVar;
+  if (LoopVar->getLocStart().isMacroID())
+    return;
+  if (!Type.isConstQualified())
+    Diag << FixItHint::CreateInsertion(LoopVar->getLocStart(), "const ");
+  Diag << FixItHint::CreateInsertion(LoopVar->getLocation(), "&");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,38 @@
+//===--- ForRangeCopyCheck.h - clang-tidy -----------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FOR_RANGE_COPY_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FOR_RANGE_COPY_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds range-based for loops whose loop variable copies an
+/// expensive-to-copy element in each iteration although the loop body only
+/// reads it.
+///
+/// Example:
+/// \code
+///   for (std::string S : Strings)  ==>  for (const std::string &S : Strings)
+///     Total += S.size();
+/// \endcode
+class ForRangeCopyCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_FOR_RANGE_COPY_CHECK_H
@@ -0,0 +1,158 @@
+//===--- ImplicitConversionInLoopCheck.cpp - clang-tidy -------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ImplicitConversionInLoopCheck.h"
+#include "TypeTraits.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void ImplicitConversionInLoopCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(forRangeStmt().bind("forRange"), this);
+}
+
+/// \brief If \p Init binds a reference to a class type temporary created by
+/// an implicit conversion, returns the expression that is converted.
+///
+/// Scalar conversions are cheap, and 'const auto &' would change the type the
+/// loop body works with, so they are ignored.
+static const Expr *getConvertedElement(const Expr *Init) {
+  if (const auto *Cleanups = dyn_cast<ExprWithCleanups>(Init))
+    Init = Cleanups->getSubExpr();
+  const auto *Temp = dyn_cast<MaterializeTemporaryExpr>(Init);
+  if (!Temp)
+    return nullptr;
+  // Look through the temporary and qualification conversions.
+  const Expr *Conversion = Temp->GetTemporaryExpr();
+  while (true) {
+    if (const auto *Bind = dyn_cast<CXXBindTemporaryExpr>(Conversion)) {
+      Conversion = Bind->getSubExpr();
+      continue;
+    }
+    const auto *Cast = dyn_cast<ImplicitCastExpr>(Conversion);
+    if (!Cast || Cast->getCastKind() != CK_NoOp)
+      break;
+    Conversion = Cast->getSubExpr();
+  }
+
+  // Otherwise dereferencing the iterator yields a temporary itself; binding a
+  // reference to it is fine.
+  if (const auto *Cast = dyn_cast<ImplicitCastExpr>(Conversion)) {
+    if (Cast->getCastKind() == CK_LValueToRValue)
+      return nullptr;
+    // A user-defined conversion operator.
+    if (Cast->getCastKind() == CK_UserDefinedConversion) {
+      const Expr *Sub = Cast->getSubExpr()->IgnoreImplicit();
+      if (const auto *Call = dyn_cast<CXXMemberCallExpr>(Sub))
+        return Call->getImplicitObjectArgument();
+      return nullptr;
+    }
+    // A converting constructor.
+    if (Cast->getCastKind() == CK_ConstructorConversion) {
+      const Expr *Sub = Cast->getSubExpr();
+      if (const auto *Bind = dyn_cast<CXXBindTemporaryExpr>(Sub))
+        Sub = Bind->getSubExpr();
+      const auto *Construct = dyn_cast<CXXConstructExpr>(Sub);
+      if (!Construct || Construct->getNumArgs() < 1)
+        return nullptr;
+      return Construct->getArg(0);
+    }
+    return nullptr;
+  }
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(Conversion)) {
+    if (Construct->getNumArgs() < 1)
+      return nullptr;
+    return Construct->getArg(0);
+  }
+  return nullptr;
+}
+
+/// \brief Whether \p From and \p To are specializations of the same class
+/// template whose arguments only differ in cv-qualifiers, as
+/// 'std::pair<const K, V>' and 'std::pair<K, V>'.
+///
+/// Only then 'const auto &' can be used like the declared type.
+static bool differOnlyInArgumentQualifiers(QualType From, QualType To,
+                                           const ASTContext &Context) {
+  const auto *FromSpec = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      From->getAsCXXRecordDecl());
+  const auto *ToSpec = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      To->getAsCXXRecordDecl());
+  if (!FromSpec || !ToSpec ||
+      FromSpec->getSpecializedTemplate()->getCanonicalDecl() !=
+          ToSpec->getSpecializedTemplate()->getCanonicalDecl())
+    return false;
+  const TemplateArgumentList &FromArgs = FromSpec->getTemplateArgs();
+  const TemplateArgumentList &ToArgs = ToSpec->getTemplateArgs();
+  if (FromArgs.size() != ToArgs.size())
+    return false;
+  for (unsigned I = 0, E = FromArgs.size(); I != E; ++I) {
+    if (FromArgs[I].getKind() == TemplateArgument::Type &&
+        ToArgs[I].getKind() == TemplateArgument::Type) {
+      if (!Context.hasSameUnqualifiedType(FromArgs[I].getAsType(),
+                                          ToArgs[I].getAsType()))
+        return false;
+    } else if (!FromArgs[I].structurallyEquals(ToArgs[I])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ImplicitConversionInLoopCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  const auto *ForRange = Result.Nodes.getNodeAs<CXXForRangeStmt>("forRange");
+  const VarDecl *LoopVar = ForRange->getLoopVariable();
+  if (!LoopVar || !LoopVar->getInit() || LoopVar->getLocation().isMacroID() ||
+      isInTemplateInstantiation(*LoopVar))
+    return;
+
+  QualType Type = LoopVar->getType();
+  if (!Type->isReferenceType())
+    return;
+  const Expr *Element = getConvertedElement(LoopVar->getInit());
+  if (!Element)
+    return;
+  QualType ElementType = Element->IgnoreParenImpCasts()->getType();
+  if (ElementType.isNull() ||
+      Result.Context->hasSameUnqualifiedType(ElementType,
+                                             Type.getNonReferenceType()))
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(LoopVar->getLocation(),
+           "the type %0 of the loop variable %1 differs from the element type "
+           "%2 of the range; each element is converted into a temporary; "
+           "consider using 'const auto &' or the element type")
+      << Type << LoopVar << ElementType;
+
+  // 'const auto &' binds to the element of any range without conversion, but
+  // it is only a drop-in replacement if the types are nearly the same.
+  SourceLocation Begin = LoopVar->getLocStart();
+  if (!Type->isLValueReferenceType() ||
+      !Type.getNonReferenceType().isConstQualified() || Begin.isMacroID() ||
+      !differOnlyInArgumentQualifiers(ElementType, Type.getNonReferenceType(),
+                                      *Result.Context))
+    return;
+  Diag << FixItHint::CreateReplacement(
+      CharSourceRange::getCharRange(Begin, LoopVar->getLocation()),
+      "const auto &");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
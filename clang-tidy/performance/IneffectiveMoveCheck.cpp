@@ -0,0 +1,202 @@
+//===--- IneffectiveMoveCheck.cpp - clang-tidy ----------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IneffectiveMoveCheck.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+#include <algorithm>
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void IneffectiveMoveCheck::registerMatchers(MatchFinder *Finder) {
+  const auto NotInInstantiation =
+      unless(hasAncestor(functionDecl(isInstantiatedFunction())));
+  Finder->addMatcher(callExpr(callee(functionDecl(hasName("::std::move"))),
+                              argumentCountIs(1), NotInInstantiation)
+                         .bind("call"),
+                     this);
+}
+
+/// \brief Returns \p E as a call to \c std::move, with or without explicit
+/// template arguments, or null.
+static const CallExpr *asMoveCall(const Expr *E) {
+  const auto *Call = dyn_cast<CallExpr>(E->IgnoreParenImpCasts());
+  if (!Call || Call->getNumArgs() != 1)
+    return nullptr;
+  const FunctionDecl *Callee = Call->getDirectCallee();
+  if (!Callee || !Callee->isInStdNamespace() || !Callee->getIdentifier() ||
+      Callee->getName() != "move")
+    return nullptr;
+  return Call;
+}
+
+/// \brief Creates a fix replacing \p Move with its argument.
+static FixItHint removeMove(const CallExpr *Move,
+                            const MatchFinder::MatchResult &Result) {
+  SourceRange CallRange = Move->getSourceRange();
+  SourceRange ArgRange = Move->getArg(0)->getSourceRange();
+  if (CallRange.getBegin().isMacroID() || CallRange.getEnd().isMacroID() ||
+      ArgRange.getBegin().isMacroID() || ArgRange.getEnd().isMacroID())
+    return FixItHint();
+  StringRef ArgText = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(ArgRange), *Result.SourceManager,
+      Result.Context->getLangOpts());
+  if (ArgText.empty())
+    return FixItHint();
+  return FixItHint::CreateReplacement(CallRange, ArgText);
+}
+
+/// \brief Whether the result of \p Move binds to an rvalue reference
+/// parameter, in which case the \c std::move can't be removed.
+static bool bindsToRValueReferenceParam(const CallExpr *Move,
+                                        ASTContext &Context) {
+  const Expr *Arg = Move;
+  const Stmt *Parent = nullptr;
+  while (true) {
+    auto Parents = Context.getParents(*Arg);
+    if (Parents.empty())
+      return false;
+    Parent = Parents[0].get<Stmt>();
+    const auto *ParentExpr = dyn_cast_or_null<Expr>(Parent);
+    if (!ParentExpr ||
+        (!isa<ImplicitCastExpr>(ParentExpr) && !isa<ParenExpr>(ParentExpr)))
+      break;
+    Arg = ParentExpr;
+  }
+
+  const FunctionDecl *Callee = nullptr;
+  ArrayRef<const Expr *> Args;
+  if (const auto *Call = dyn_cast_or_null<CallExpr>(Parent)) {
+    Callee = Call->getDirectCallee();
+    Args = llvm::makeArrayRef(Call->getArgs(), Call->getNumArgs());
+    // The object argument of member operators isn't a parameter.
+    if (isa<CXXOperatorCallExpr>(Call) && Callee && isa<CXXMethodDecl>(Callee))
+      Args = Args.slice(1);
+  } else if (const auto *Construct =
+                 dyn_cast_or_null<CXXConstructExpr>(Parent)) {
+    Callee = Construct->getConstructor();
+    Args = llvm::makeArrayRef(Construct->getArgs(), Construct->getNumArgs());
+  }
+  if (!Callee)
+    return false;
+  for (unsigned I = 0,
+                E = std::min<unsigned>(Args.size(), Callee->getNumParams());
+       I != E; ++I) {
+    if (Args[I] == Arg)
+      return Callee->getParamDecl(I)->getType()->isRValueReferenceType();
+  }
+  return false;
+}
+
+/// \brief Returns the return statement whose value is \p Move, looking
+/// through implicit nodes, or null.
+static const ReturnStmt *getEnclosingReturn(const CallExpr *Move,
+                                            ASTContext &Context) {
+  const Stmt *Child = Move;
+  while (true) {
+    auto Parents = Context.getParents(*Child);
+    if (Parents.empty())
+      return nullptr;
+    const Stmt *Parent = Parents[0].get<Stmt>();
+    if (const auto *Return = dyn_cast_or_null<ReturnStmt>(Parent))
+      return Return;
+    if (!Parent ||
+        (!isa<ImplicitCastExpr>(Parent) && !isa<ParenExpr>(Parent) &&
+         !isa<CXXConstructExpr>(Parent) &&
+         !isa<MaterializeTemporaryExpr>(Parent) &&
+         !isa<CXXBindTemporaryExpr>(Parent) && !isa<ExprWithCleanups>(Parent)))
+      return nullptr;
+    Child = Parent;
+  }
+}
+
+/// \brief Diagnoses \p Move if it is the returned value and prevents copy
+/// elision or is redundant.
+///
+/// \returns whether \p Move is such a returned value, even if it isn't
+/// diagnosed because it comes from a macro.
+bool IneffectiveMoveCheck::checkReturnedMove(
+    const CallExpr *Move, const MatchFinder::MatchResult &Result) {
+  const ReturnStmt *Return = getEnclosingReturn(Move, *Result.Context);
+  if (!Return || !Return->getRetValue())
+    return false;
+  const auto *Construct =
+      dyn_cast<CXXConstructExpr>(Return->getRetValue()->IgnoreImplicit());
+  if (!Construct || Construct->getNumArgs() != 1 ||
+      asMoveCall(Construct->getArg(0)) != Move)
+    return false;
+
+  const auto *Ref =
+      dyn_cast<DeclRefExpr>(Move->getArg(0)->IgnoreParenImpCasts());
+  if (!Ref || Ref->refersToEnclosingLocal())
+    return false;
+  // Catch parameters are neither elided nor moved implicitly.
+  const auto *Var = dyn_cast<VarDecl>(Ref->getDecl());
+  if (!Var || !Var->hasLocalStorage() || Var->isExceptionVariable() ||
+      Var->getType()->isReferenceType() ||
+      Var->getType().isVolatileQualified())
+    return false;
+  // Copy elision and the implicit move only apply if the variable has the
+  // type of the returned object.
+  if (!Result.Context->hasSameUnqualifiedType(Var->getType(),
+                                              Construct->getType()))
+    return false;
+
+  if (Move->getLocStart().isMacroID())
+    return true;
+  if (isa<ParmVarDecl>(Var)) {
+    diag(Move->getLocStart(), "redundant std::move of parameter %0 in return "
+                              "statement; parameters are moved implicitly")
+        << Var << removeMove(Move, Result);
+  } else {
+    diag(Move->getLocStart(), "std::move of local variable %0 in return "
+                              "statement prevents copy elision")
+        << Var << removeMove(Move, Result);
+  }
+  return true;
+}
+
+void IneffectiveMoveCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Call = Result.Nodes.getNodeAs<CallExpr>("call");
+  if (checkReturnedMove(Call, Result) || Call->getLocStart().isMacroID())
+    return;
+  const Expr *Arg = Call->getArg(0);
+  QualType ArgType = Arg->getType();
+  if (ArgType.isNull() || ArgType->isDependentType() ||
+      ArgType->isIncompleteType() || ArgType->isArrayType())
+    return;
+
+  ASTContext &Context = *Result.Context;
+  bool IsConst = ArgType.isConstQualified();
+  if (!IsConst && !ArgType.isTriviallyCopyableType(Context))
+    return;
+  if (bindsToRValueReferenceParam(Call, Context))
+    return;
+
+  if (IsConst) {
+    diag(Call->getLocStart(), "std::move of the const expression has no "
+                              "effect; the object is copied")
+        << removeMove(Call, Result);
+  } else {
+    diag(Call->getLocStart(), "std::move of an expression of the trivially "
+                              "copyable type %0 has no effect")
+        << ArgType.getUnqualifiedType() << removeMove(Call, Result);
+  }
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,40 @@
+//===--- IneffectiveMoveCheck.h - clang-tidy --------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFECTIVE_MOVE_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFECTIVE_MOVE_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds \c std::move calls that make code slower or don't do anything.
+///
+///   - 'return std::move(Local);' prevents copy elision. For parameters the
+///     \c std::move is redundant, they are moved implicitly. The \c std::move
+///     is removed.
+///   - \c std::move of a const object selects the copy constructor anyway.
+///   - \c std::move of a trivially copyable value is a plain copy.
+class IneffectiveMoveCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  bool checkReturnedMove(const CallExpr *Move,
+                         const ast_matchers::MatchFinder::MatchResult &Result);
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFECTIVE_MOVE_CHECK_H
@@ -0,0 +1,180 @@
+//===--- InefficientAlgorithmCheck.cpp - clang-tidy -----------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "InefficientAlgorithmCheck.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void InefficientAlgorithmCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(
+      callExpr(callee(functionDecl(anyOf(
+                   hasName("::std::find"), hasName("::std::count"),
+                   hasName("::std::equal_range"), hasName("::std::lower_bound"),
+                   hasName("::std::upper_bound")))),
+               argumentCountIs(3),
+               unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("call"),
+      this);
+}
+
+namespace {
+/// \brief The associative containers, with the positions of their template
+/// arguments.
+struct ContainerInfo {
+  bool IsMap;
+  bool IsOrdered;
+  /// \brief The index of the comparison (ordered) or equality (unordered)
+  /// template argument.
+  unsigned CompareIndex;
+};
+} // namespace
+
+static bool getContainerInfo(const ClassTemplateSpecializationDecl &Container,
+                             ContainerInfo &Info) {
+  std::string Name = Container.getQualifiedNameAsString();
+  Info.IsMap = Name == "std::map" || Name == "std::multimap" ||
+               Name == "std::unordered_map" ||
+               Name == "std::unordered_multimap";
+  Info.IsOrdered = Name == "std::set" || Name == "std::multiset" ||
+                   Name == "std::map" || Name == "std::multimap";
+  bool IsUnorderedSet =
+      Name == "std::unordered_set" || Name == "std::unordered_multiset";
+  if (!Info.IsMap && !Info.IsOrdered && !IsUnorderedSet)
+    return false;
+  // set<Key, Compare>, map<Key, T, Compare>, unordered_set<Key, Hash, Equal>,
+  // unordered_map<Key, T, Hash, Equal>.
+  Info.CompareIndex = (Info.IsOrdered ? 1 : 2) + (Info.IsMap ? 1 : 0);
+  return true;
+}
+
+/// \brief If \p E is a call to the member function \p Name (or its 'c'
+/// variant) without arguments, returns the object expression.
+static const MemberExpr *getIteratorCall(const Expr *E, StringRef Name) {
+  E = E->IgnoreImplicit();
+  // Iterators are passed by value.
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(E)) {
+    if (Construct->getNumArgs() != 1)
+      return nullptr;
+    E = Construct->getArg(0)->IgnoreImplicit();
+  }
+  if (const auto *Temp = dyn_cast<MaterializeTemporaryExpr>(E))
+    E = Temp->GetTemporaryExpr()->IgnoreImplicit();
+  const auto *Call = dyn_cast<CXXMemberCallExpr>(E->IgnoreParenImpCasts());
+  if (!Call || Call->getNumArgs() != 0 || !Call->getMethodDecl() ||
+      !Call->getMethodDecl()->getIdentifier())
+    return nullptr;
+  StringRef Method = Call->getMethodDecl()->getName();
+  if (Method != Name && Method != ("c" + Name).str())
+    return nullptr;
+  return dyn_cast<MemberExpr>(Call->getCallee()->IgnoreParens());
+}
+
+/// \brief Returns the variable or field named by \p E, if \p E is just that.
+static const ValueDecl *getNamedDecl(const Expr *E) {
+  E = E->IgnoreParenImpCasts();
+  if (const auto *Ref = dyn_cast<DeclRefExpr>(E))
+    return Ref->getDecl();
+  if (const auto *Member = dyn_cast<MemberExpr>(E))
+    if (isa<CXXThisExpr>(Member->getBase()->IgnoreParenImpCasts()))
+      return Member->getMemberDecl();
+  return nullptr;
+}
+
+/// \brief Whether template argument \p Index of \p Container is the default
+/// \p DefaultName.
+static bool hasDefaultArgument(const ClassTemplateSpecializationDecl &Container,
+                               unsigned Index, StringRef DefaultName) {
+  const TemplateArgumentList &Args = Container.getTemplateArgs();
+  if (Index >= Args.size() || Args[Index].getKind() != TemplateArgument::Type)
+    return false;
+  const CXXRecordDecl *Record = Args[Index].getAsType()->getAsCXXRecordDecl();
+  return Record && Record->getQualifiedNameAsString() == DefaultName;
+}
+
+void InefficientAlgorithmCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Call = Result.Nodes.getNodeAs<CallExpr>("call");
+  StringRef Algorithm = Call->getDirectCallee()->getName();
+
+  const MemberExpr *Begin = getIteratorCall(Call->getArg(0), "begin");
+  const MemberExpr *End = getIteratorCall(Call->getArg(1), "end");
+  if (!Begin || !End || Begin->isArrow() != End->isArrow())
+    return;
+  const ValueDecl *ContainerDecl = getNamedDecl(Begin->getBase());
+  if (!ContainerDecl || ContainerDecl != getNamedDecl(End->getBase()))
+    return;
+
+  QualType ContainerType = Begin->getBase()->getType();
+  if (Begin->isArrow())
+    ContainerType = ContainerType->getPointeeType();
+  const auto *Container = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      ContainerType->getAsCXXRecordDecl());
+  ContainerInfo Info;
+  if (!Container || !getContainerInfo(*Container, Info))
+    return;
+  bool IsBound = Algorithm != "find" && Algorithm != "count";
+  // Unordered containers aren't sorted; the binary searches are meaningless.
+  if (IsBound && !Info.IsOrdered)
+    return;
+
+  SourceLocation Loc = Call->getLocStart();
+  if (Loc.isMacroID())
+    return;
+  DiagnosticBuilder Diag =
+      diag(Loc, "calling 'std::%0' on the full range of an associative "
+                "container takes linear time; consider using the container's "
+                "member function instead")
+      << Algorithm;
+
+  // The member function compares keys with the container's comparison, the
+  // algorithm compares elements with operator== or operator<. Both agree for
+  // sets with the default comparison when searching for a key.
+  if (Info.IsMap ||
+      !hasDefaultArgument(*Container, Info.CompareIndex,
+                          Info.IsOrdered ? "std::less" : "std::equal_to"))
+    return;
+  const TemplateArgumentList &Args = Container->getTemplateArgs();
+  if (Args.size() == 0 || Args[0].getKind() != TemplateArgument::Type)
+    return;
+  QualType KeyType = Args[0].getAsType();
+  const Expr *Value = Call->getArg(2);
+  if (!Result.Context->hasSameUnqualifiedType(
+          Value->IgnoreParenImpCasts()->getType().getNonReferenceType(),
+          KeyType))
+    return;
+
+  const SourceManager &SM = *Result.SourceManager;
+  const LangOptions &LangOpts = Result.Context->getLangOpts();
+  StringRef ContainerText = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(Begin->getBase()->getSourceRange()), SM,
+      LangOpts);
+  StringRef ValueText = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(Value->getSourceRange()), SM, LangOpts);
+  if (ContainerText.empty() || ValueText.empty() ||
+      Call->getLocEnd().isMacroID())
+    return;
+  Diag << FixItHint::CreateReplacement(
+      CharSourceRange::getTokenRange(Call->getSourceRange()),
+      (ContainerText + (Begin->isArrow() ? "->" : ".") + Algorithm + "(" +
+       ValueText + ")")
+          .str());
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,43 @@
+//===--- InefficientAlgorithmCheck.h - clang-tidy ---------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_ALGORITHM_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_ALGORITHM_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds calls to \c std::find, \c std::count, \c std::equal_range,
+/// \c std::lower_bound and \c std::upper_bound over the full range of an
+/// associative container, which take linear time although the container's
+/// member function of the same name is logarithmic or constant.
+///
+/// Example:
+/// \code
+///   std::find(S.begin(), S.end(), X)   ==>   S.find(X)
+/// \endcode
+///
+/// The call is only replaced when the member function gives the same result,
+/// i.e. the container uses the default comparison and the searched value has
+/// the key type. Algorithms searching the key-value pairs of a map are only
+/// reported.
+class InefficientAlgorithmCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_ALGORITHM_CHECK_H
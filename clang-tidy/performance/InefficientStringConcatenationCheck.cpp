@@ -0,0 +1,134 @@
+//===--- InefficientStringConcatenationCheck.cpp - clang-tidy -------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "InefficientStringConcatenationCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+InefficientStringConcatenationCheck::InefficientStringConcatenationCheck()
+    : StrictMode(false) {}
+
+void InefficientStringConcatenationCheck::registerMatchers(
+    MatchFinder *Finder) {
+  StrictMode = getOption("StrictMode", 0u) != 0;
+
+  const auto Assignment = operatorCallExpr(hasOverloadedOperatorName("="));
+  const auto TwineConversion = constructExpr(hasDeclaration(
+      constructorDecl(ofClass(recordDecl(hasName("::llvm::Twine"))))));
+  const auto InLoop = hasAncestor(
+      stmt(anyOf(forStmt(), forRangeStmt(), whileStmt(), doStmt())));
+
+  if (StrictMode) {
+    Finder->addMatcher(Assignment.bind("assign"), this);
+    Finder->addMatcher(TwineConversion.bind("twine"), this);
+  } else {
+    Finder->addMatcher(operatorCallExpr(Assignment, InLoop).bind("assign"),
+                       this);
+    Finder->addMatcher(constructExpr(TwineConversion, InLoop).bind("twine"),
+                       this);
+  }
+}
+
+static bool isBasicString(QualType Type) {
+  const CXXRecordDecl *Record = Type->getAsCXXRecordDecl();
+  return Record && Record->getQualifiedNameAsString() == "std::basic_string";
+}
+
+/// \brief Returns \p E as a string \c operator+ call, or null.
+static const CXXOperatorCallExpr *asStringPlus(const Expr *E) {
+  const auto *Call = dyn_cast<CXXOperatorCallExpr>(E->IgnoreImplicit());
+  if (!Call || Call->getOperator() != OO_Plus || Call->getNumArgs() != 2 ||
+      !isBasicString(Call->getType()))
+    return nullptr;
+  return Call;
+}
+
+/// \brief Returns the number of \c operator+ calls in the left-associative
+/// chain \p Plus, and sets \p First to the leftmost operand.
+static unsigned getChainLength(const CXXOperatorCallExpr *Plus,
+                               const Expr *&First) {
+  unsigned Length = 0;
+  while (Plus) {
+    ++Length;
+    First = Plus->getArg(0);
+    Plus = asStringPlus(First);
+  }
+  return Length;
+}
+
+/// \brief Whether \p LHS and \p RHS name the same variable or data member of
+/// \c this.
+static bool isSameVariable(const Expr *LHS, const Expr *RHS) {
+  LHS = LHS->IgnoreParenImpCasts();
+  RHS = RHS->IgnoreParenImpCasts();
+  if (const auto *LRef = dyn_cast<DeclRefExpr>(LHS)) {
+    const auto *RRef = dyn_cast<DeclRefExpr>(RHS);
+    return RRef && LRef->getDecl() == RRef->getDecl();
+  }
+  if (const auto *LMember = dyn_cast<MemberExpr>(LHS)) {
+    const auto *RMember = dyn_cast<MemberExpr>(RHS);
+    return RMember && LMember->getMemberDecl() == RMember->getMemberDecl() &&
+           isa<CXXThisExpr>(LMember->getBase()->IgnoreParenImpCasts()) &&
+           isa<CXXThisExpr>(RMember->getBase()->IgnoreParenImpCasts());
+  }
+  return false;
+}
+
+void InefficientStringConcatenationCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  if (const auto *Twine = Result.Nodes.getNodeAs<CXXConstructExpr>("twine")) {
+    if (Twine->getNumArgs() != 1)
+      return;
+    const CXXOperatorCallExpr *Plus = asStringPlus(Twine->getArg(0));
+    if (!Plus || Plus->getOperatorLoc().isMacroID())
+      return;
+    diag(Plus->getOperatorLoc(),
+         "string concatenation allocates temporary strings only to convert "
+         "the result to 'llvm::Twine'; consider concatenating 'llvm::Twine' "
+         "objects instead, e.g. 'Twine(A) + B'");
+    return;
+  }
+
+  const auto *Assign = Result.Nodes.getNodeAs<CXXOperatorCallExpr>("assign");
+  if (Assign->getNumArgs() != 2 || !isBasicString(Assign->getArg(0)->getType()))
+    return;
+  const CXXOperatorCallExpr *Plus = asStringPlus(Assign->getArg(1));
+  if (!Plus)
+    return;
+  const Expr *First = nullptr;
+  unsigned Length = getChainLength(Plus, First);
+  bool AppendsToItself = isSameVariable(Assign->getArg(0), First);
+  if (!AppendsToItself && Length < 2)
+    return;
+
+  SourceLocation AssignLoc = Assign->getOperatorLoc();
+  if (AssignLoc.isMacroID())
+    return;
+  DiagnosticBuilder Diag =
+      diag(AssignLoc, "string concatenation results in allocation of "
+                      "unnecessary temporary strings; consider using "
+                      "'operator+=' or 'string::append()' instead");
+
+  // 'S = S + A' ==> 'S += A'
+  if (AppendsToItself && Length == 1 && !Plus->getOperatorLoc().isMacroID())
+    Diag << FixItHint::CreateReplacement(
+        CharSourceRange::getTokenRange(AssignLoc, Plus->getOperatorLoc()),
+        "+=");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
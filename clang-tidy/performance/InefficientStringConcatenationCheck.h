@@ -0,0 +1,47 @@
+//===--- InefficientStringConcatenationCheck.h - clang-tidy -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_STRING_CONCATENATION_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_STRING_CONCATENATION_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds \c std::basic_string concatenations that create a temporary
+/// string for every \c operator+.
+///
+/// Two patterns are diagnosed:
+///   - an \c operator+ chain assigned to a string, when it either starts with
+///     the assigned string ('S = S + A') or has more than one \c operator+
+///     ('S = A + B + C'). 'S = S + A' is rewritten to 'S += A'.
+///   - an \c operator+ chain that is only built to be converted to
+///     \c llvm::Twine, e.g. when passed to a 'const Twine &' parameter.
+///     Concatenating \c Twines doesn't allocate at all.
+///
+/// By default only concatenations inside loops are reported. Setting the
+/// "StrictMode" option to 1 reports them everywhere.
+class InefficientStringConcatenationCheck : public ClangTidyCheck {
+public:
+  InefficientStringConcatenationCheck();
+
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  bool StrictMode;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_STRING_CONCATENATION_CHECK_H
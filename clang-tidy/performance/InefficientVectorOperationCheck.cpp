@@ -0,0 +1,291 @@
+//===--- InefficientVectorOperationCheck.cpp - clang-tidy -----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "InefficientVectorOperationCheck.h"
+#include "DeclRefExprUtils.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+#include "llvm/ADT/Twine.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void InefficientVectorOperationCheck::registerMatchers(MatchFinder *Finder) {
+  const auto NotInInstantiation =
+      unless(hasAncestor(functionDecl(isInstantiatedFunction())));
+  Finder->addMatcher(forStmt(NotInInstantiation).bind("loop"), this);
+  Finder->addMatcher(forRangeStmt(NotInInstantiation).bind("loop"), this);
+}
+
+static bool isVectorType(QualType Type) {
+  const CXXRecordDecl *Record = Type->getAsCXXRecordDecl();
+  if (!Record)
+    return false;
+  std::string Name = Record->getQualifiedNameAsString();
+  return Name == "std::vector" || Name == "llvm::SmallVector";
+}
+
+static const CXXMemberCallExpr *asAppendCall(const Stmt *S) {
+  const auto *E = dyn_cast_or_null<Expr>(S);
+  if (!E)
+    return nullptr;
+  const auto *Call = dyn_cast<CXXMemberCallExpr>(E->IgnoreImplicit());
+  if (!Call || !Call->getMethodDecl() ||
+      !Call->getMethodDecl()->getIdentifier())
+    return nullptr;
+  StringRef Name = Call->getMethodDecl()->getName();
+  if (Name != "push_back" && Name != "emplace_back")
+    return nullptr;
+  return Call;
+}
+
+/// \brief Returns the \c push_back or \c emplace_back call that is a direct
+/// child of the loop body \p Body, if there is exactly one.
+static const CXXMemberCallExpr *getSingleAppend(const Stmt *Body) {
+  const auto *Block = dyn_cast<CompoundStmt>(Body);
+  if (!Block)
+    return asAppendCall(Body);
+
+  const CXXMemberCallExpr *Append = nullptr;
+  for (CompoundStmt::const_body_iterator I = Block->body_begin(),
+                                         E = Block->body_end();
+       I != E; ++I) {
+    const CXXMemberCallExpr *Call = asAppendCall(*I);
+    if (!Call)
+      continue;
+    if (Append)
+      return nullptr;
+    Append = Call;
+  }
+  return Append;
+}
+
+/// \brief Whether \p E can be evaluated once more before the loop without
+/// side effects: a constant, a variable, or a const member function without
+/// arguments (e.g. 'C.size()') called on a variable.
+static bool isSimpleBound(const Expr *E) {
+  E = E->IgnoreParenImpCasts();
+  if (isa<IntegerLiteral>(E) || isa<DeclRefExpr>(E))
+    return true;
+  if (const auto *Member = dyn_cast<MemberExpr>(E))
+    return isSimpleBound(Member->getBase());
+  if (const auto *Call = dyn_cast<CXXMemberCallExpr>(E)) {
+    const CXXMethodDecl *Method = Call->getMethodDecl();
+    return Method && Method->isConst() && Call->getNumArgs() == 0 &&
+           isSimpleBound(Call->getImplicitObjectArgument());
+  }
+  return false;
+}
+
+/// \brief Returns the bound of 'for (T I = 0; I < Bound; ++I)' if \p For has
+/// this form and the body doesn't modify 'I'.
+static const Expr *getCountedLoopBound(const ForStmt *For) {
+  const auto *Init = dyn_cast_or_null<DeclStmt>(For->getInit());
+  if (!Init || !Init->isSingleDecl())
+    return nullptr;
+  const auto *Counter = dyn_cast<VarDecl>(Init->getSingleDecl());
+  if (!Counter || !Counter->getType()->isIntegerType() || !Counter->getInit())
+    return nullptr;
+  const auto *Start =
+      dyn_cast<IntegerLiteral>(Counter->getInit()->IgnoreParenImpCasts());
+  if (!Start || Start->getValue() != 0)
+    return nullptr;
+
+  const auto *Cond = dyn_cast_or_null<BinaryOperator>(For->getCond());
+  if (!Cond || (Cond->getOpcode() != BO_LT && Cond->getOpcode() != BO_NE))
+    return nullptr;
+  const auto *CondVar =
+      dyn_cast<DeclRefExpr>(Cond->getLHS()->IgnoreParenImpCasts());
+  if (!CondVar || CondVar->getDecl() != Counter ||
+      !isSimpleBound(Cond->getRHS()))
+    return nullptr;
+
+  const auto *Inc = dyn_cast_or_null<UnaryOperator>(For->getInc());
+  if (!Inc || !Inc->isIncrementOp())
+    return nullptr;
+  const auto *IncVar =
+      dyn_cast<DeclRefExpr>(Inc->getSubExpr()->IgnoreParenImpCasts());
+  if (!IncVar || IncVar->getDecl() != Counter)
+    return nullptr;
+
+  if (!isOnlyUsedAsConst(*Counter, *For->getBody()))
+    return nullptr;
+  return Cond->getRHS();
+}
+
+/// \brief Whether \p Record, or one of its bases, has a 'size() const'
+/// method.
+static bool hasSizeMethod(const CXXRecordDecl *Record) {
+  if (!Record || !Record->hasDefinition())
+    return false;
+  Record = Record->getDefinition();
+  for (CXXRecordDecl::method_iterator I = Record->method_begin(),
+                                      E = Record->method_end();
+       I != E; ++I) {
+    if (I->getIdentifier() && I->getName() == "size" &&
+        I->getNumParams() == 0 && I->isConst())
+      return true;
+  }
+  for (CXXRecordDecl::base_class_const_iterator I = Record->bases_begin(),
+                                                E = Record->bases_end();
+       I != E; ++I) {
+    if (hasSizeMethod(I->getType()->getAsCXXRecordDecl()))
+      return true;
+  }
+  return false;
+}
+
+/// \brief Whether \p Bound can't be negative: it is unsigned, a \c size()
+/// call, or a non-negative constant.
+///
+/// A negative bound means the loop doesn't run at all, while 'reserve()'
+/// converts it to a huge unsigned value.
+static bool isNonNegativeBound(const Expr *Bound, const ASTContext &Context) {
+  Bound = Bound->IgnoreParenImpCasts();
+  if (Bound->getType()->isUnsignedIntegerType())
+    return true;
+  if (const auto *Call = dyn_cast<CXXMemberCallExpr>(Bound)) {
+    const CXXMethodDecl *Method = Call->getMethodDecl();
+    if (Method && Method->getIdentifier() && Method->getName() == "size")
+      return true;
+  }
+  llvm::APSInt Value;
+  return Bound->EvaluateAsInt(Value, Context) && !Value.isNegative();
+}
+
+/// \brief Returns the source text of an expression computing the number of
+/// iterations of \p Loop, or an empty string if it isn't known up front.
+///
+/// \p CanReserve is set to false if the expression may be negative.
+static std::string getTripCount(const Stmt *Loop,
+                                const MatchFinder::MatchResult &Result,
+                                bool &CanReserve) {
+  const SourceManager &SM = *Result.SourceManager;
+  const LangOptions &LangOpts = Result.Context->getLangOpts();
+  CanReserve = true;
+  if (const auto *For = dyn_cast<ForStmt>(Loop)) {
+    const Expr *Bound = getCountedLoopBound(For);
+    if (!Bound)
+      return std::string();
+    CanReserve = isNonNegativeBound(Bound, *Result.Context);
+    return Lexer::getSourceText(
+        CharSourceRange::getTokenRange(Bound->getSourceRange()), SM, LangOpts);
+  }
+
+  const auto *ForRange = cast<CXXForRangeStmt>(Loop);
+  const Expr *Range = ForRange->getRangeInit();
+  if (!Range)
+    return std::string();
+  QualType RangeType = Range->getType();
+  if (const auto *Array =
+          Result.Context->getAsConstantArrayType(RangeType))
+    return Array->getSize().toString(10, /*Signed=*/false);
+  if (!isSimpleBound(Range) || !hasSizeMethod(RangeType->getAsCXXRecordDecl()))
+    return std::string();
+  StringRef RangeText = Lexer::getSourceText(
+      CharSourceRange::getTokenRange(Range->getSourceRange()), SM, LangOpts);
+  if (RangeText.empty())
+    return std::string();
+  return (RangeText + ".size()").str();
+}
+
+/// \brief Whether \p Vector is declared empty in \p Block before \p Loop and
+/// isn't used between its declaration and the loop.
+static bool isFreshlyDeclaredBefore(const VarDecl *Vector,
+                                    const CompoundStmt *Block,
+                                    const Stmt *Loop) {
+  bool SeenDecl = false;
+  for (CompoundStmt::const_body_iterator I = Block->body_begin(),
+                                         E = Block->body_end();
+       I != E; ++I) {
+    if (*I == Loop)
+      return SeenDecl;
+    if (!SeenDecl) {
+      const auto *DS = dyn_cast<DeclStmt>(*I);
+      if (DS && DS->isSingleDecl() && DS->getSingleDecl() == Vector)
+        SeenDecl = true;
+      continue;
+    }
+    llvm::SmallVector<const DeclRefExpr *, 4> Refs;
+    collectDeclRefs(*Vector, **I, Refs);
+    if (!Refs.empty())
+      return false;
+  }
+  return false;
+}
+
+void InefficientVectorOperationCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  const auto *Loop = Result.Nodes.getNodeAs<Stmt>("loop");
+  if (Loop->getLocStart().isMacroID())
+    return;
+  const Stmt *Body = isa<ForStmt>(Loop)
+                         ? cast<ForStmt>(Loop)->getBody()
+                         : cast<CXXForRangeStmt>(Loop)->getBody();
+
+  const CXXMemberCallExpr *Append = getSingleAppend(Body);
+  if (!Append)
+    return;
+  const auto *VectorRef = dyn_cast<DeclRefExpr>(
+      Append->getImplicitObjectArgument()->IgnoreParenImpCasts());
+  if (!VectorRef)
+    return;
+  const auto *Vector = dyn_cast<VarDecl>(VectorRef->getDecl());
+  if (!Vector || !Vector->isLocalVarDecl() || !Vector->hasLocalStorage() ||
+      !isVectorType(Vector->getType()))
+    return;
+
+  // The vector must start out empty...
+  const auto *Construct =
+      dyn_cast_or_null<CXXConstructExpr>(Vector->getInit());
+  if (!Construct || Construct->getNumArgs() != 0)
+    return;
+  // ... only grow by the one call in the loop ...
+  llvm::SmallVector<const DeclRefExpr *, 4> BodyRefs;
+  collectDeclRefs(*Vector, *Body, BodyRefs);
+  if (BodyRefs.size() != 1)
+    return;
+  // ... and be declared right before the loop.
+  auto Parents = Result.Context->getParents(*Loop);
+  if (Parents.empty())
+    return;
+  const auto *Block = Parents[0].get<CompoundStmt>();
+  if (!Block || !isFreshlyDeclaredBefore(Vector, Block, Loop))
+    return;
+
+  bool CanReserve;
+  std::string TripCount = getTripCount(Loop, Result, CanReserve);
+  if (TripCount.empty())
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(Append->getExprLoc(),
+           "%0 is called inside a loop with a known number of iterations; "
+           "consider pre-allocating the vector capacity before the loop")
+      << Append->getMethodDecl();
+  if (!CanReserve)
+    return;
+  const SourceManager &SM = *Result.SourceManager;
+  SourceLocation LoopStart = Loop->getLocStart();
+  std::string Indent(SM.getSpellingColumnNumber(LoopStart) - 1, ' ');
+  Diag << FixItHint::CreateInsertion(
+      LoopStart,
+      (Vector->getName() + ".reserve(" + TripCount + ");\n" + Indent).str());
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,45 @@
+//===--- InefficientVectorOperationCheck.h - clang-tidy ---------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_VECTOR_OPERATION_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_VECTOR_OPERATION_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds loops that \c push_back or \c emplace_back into a vector
+/// declared right before the loop, when the number of iterations is known up
+/// front, and inserts a \c reserve() call before the loop.
+///
+/// Example:
+/// \code
+///   std::vector<int> V;
+///                                           V.reserve(N);
+///   for (size_t I = 0; I < N; ++I)  ==>     for (size_t I = 0; I < N; ++I)
+///     V.push_back(I);                         V.push_back(I);
+/// \endcode
+///
+/// Handled loops are counted 'for' loops starting at 0 with a simple bound and
+/// range-based for loops over a container with \c size() or over an array.
+/// Handled vectors are \c std::vector and \c llvm::SmallVector. Bounds that
+/// may be negative are diagnosed without a fix.
+class InefficientVectorOperationCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_INEFFICIENT_VECTOR_OPERATION_CHECK_H
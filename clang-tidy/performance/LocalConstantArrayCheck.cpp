@@ -0,0 +1,142 @@
+//===--- LocalConstantArrayCheck.cpp - clang-tidy -------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "LocalConstantArrayCheck.h"
+#include "DeclRefExprUtils.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void LocalConstantArrayCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(
+      varDecl(hasAncestor(functionDecl()),
+              unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("var"),
+      this);
+}
+
+/// \brief Returns the element type of the built-in array or \c std::array
+/// \p Type, or a null type.
+static QualType getElementType(QualType Type, const ASTContext &Context) {
+  if (const ConstantArrayType *Array = Context.getAsConstantArrayType(Type))
+    return Array->getElementType();
+  const auto *Record = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      Type->getAsCXXRecordDecl());
+  if (!Record || Record->getQualifiedNameAsString() != "std::array" ||
+      Record->getTemplateArgs().size() < 1 ||
+      Record->getTemplateArgs()[0].getKind() != TemplateArgument::Type)
+    return QualType();
+  return Record->getTemplateArgs()[0].getAsType();
+}
+
+/// \brief Whether the use \p Ref of a built-in array reads its elements only.
+static bool isReadOnlyArrayUse(const DeclRefExpr &Ref,
+                               const ParentMap &Parents) {
+  const Stmt *Parent = Parents.getParent(&Ref);
+  while (Parent && isa<ParenExpr>(Parent))
+    Parent = Parents.getParent(Parent);
+  if (!Parent)
+    return false;
+  if (isa<UnaryExprOrTypeTraitExpr>(Parent))
+    return true;
+  const auto *Decay = dyn_cast<ImplicitCastExpr>(Parent);
+  if (!Decay || Decay->getCastKind() != CK_ArrayToPointerDecay)
+    return isConstUse(Ref, Parents);
+
+  if (const auto *Subscript =
+          dyn_cast_or_null<ArraySubscriptExpr>(Parents.getParent(Decay)))
+    return Subscript->getBase() == Decay && isConstUse(*Subscript, Parents);
+  // Passing the array on as a pointer to const.
+  const Expr *Pointer = Decay;
+  while (const auto *Cast =
+             dyn_cast_or_null<ImplicitCastExpr>(Parents.getParent(Pointer))) {
+    if (Cast->getCastKind() != CK_NoOp)
+      break;
+    Pointer = Cast;
+  }
+  return Pointer->getType()->getPointeeType().isConstQualified();
+}
+
+static bool isNeverWritten(const VarDecl &Var, const Stmt &Body) {
+  llvm::SmallVector<const DeclRefExpr *, 8> Refs;
+  collectDeclRefs(Var, Body, Refs);
+  ParentMap Parents(const_cast<Stmt *>(&Body));
+  for (const DeclRefExpr *Ref : Refs) {
+    if (!isReadOnlyArrayUse(*Ref, Parents))
+      return false;
+  }
+  return true;
+}
+
+void LocalConstantArrayCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Var = Result.Nodes.getNodeAs<VarDecl>("var");
+  if (isa<ParmVarDecl>(Var) || !Var->isLocalVarDecl() ||
+      !Var->hasLocalStorage() || !Var->getInit() ||
+      Var->getLocation().isMacroID())
+    return;
+  ASTContext &Context = *Result.Context;
+  QualType Type = Var->getType();
+  QualType ElementType = getElementType(Type, Context);
+  if (ElementType.isNull() || ElementType->isDependentType() ||
+      !ElementType->isLiteralType(Context) ||
+      !Var->getInit()->isConstantInitializer(Context, /*ForRef=*/false))
+    return;
+
+  // Statics aren't allowed in constexpr functions.
+  const auto *Function =
+      dyn_cast_or_null<FunctionDecl>(Var->getParentFunctionOrMethod());
+  if (!Function || !Function->getBody() || Function->isConstexpr())
+    return;
+
+  // Elements of const arrays can't be written.
+  bool IsBuiltinArray = Type->isArrayType();
+  bool IsConst = IsBuiltinArray
+                     ? Context.getBaseElementType(Type).isConstQualified()
+                     : Type.isConstQualified();
+  if (!IsConst &&
+      (!IsBuiltinArray || !isNeverWritten(*Var, *Function->getBody())))
+    return;
+
+  const char *Replacement = "static ";
+  if (!IsConst) {
+    if (Context.getLangOpts().CPlusPlus11)
+      Replacement = "static constexpr ";
+    else if (!ElementType->isPointerType())
+      Replacement = "static const ";
+    else
+      Replacement = nullptr;
+  }
+
+  DiagnosticBuilder Diag =
+      diag(Var->getLocation(),
+           "local array %0 is initialized with constants and never written; "
+           "consider making it static so that it isn't rebuilt in every call")
+      << Var;
+  SourceLocation Begin = Var->getLocStart();
+  if (!Replacement || Begin.isMacroID())
+    return;
+  // A declaration with several variables would make all of them static.
+  auto Parents = Context.getParents(*Var);
+  const DeclStmt *DS = Parents.empty() ? nullptr : Parents[0].get<DeclStmt>();
+  if (!DS || !DS->isSingleDecl())
+    return;
+  Diag << FixItHint::CreateInsertion(Begin, Replacement);
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
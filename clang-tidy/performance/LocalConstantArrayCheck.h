@@ -0,0 +1,46 @@
+//===--- LocalConstantArrayCheck.h - clang-tidy -----------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_LOCAL_CONSTANT_ARRAY_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_LOCAL_CONSTANT_ARRAY_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds non-static local arrays and \c std::arrays with a constant
+/// initializer that are never written, which the compiler may copy onto the
+/// stack in every call.
+///
+/// Example:
+/// \code
+///   const int Table[] = {1, 2, 4, 8};
+///   ==>  static const int Table[] = {1, 2, 4, 8};
+///   const char *Names[] = {"a", "b"};
+///   ==>  static constexpr const char *Names[] = {"a", "b"};
+/// \endcode
+///
+/// Arrays that are already const are made \c static. Other built-in arrays are
+/// made <tt>static constexpr</tt> in C++11, or <tt>static const</tt> when
+/// their elements aren't pointers; they are only reported if no element is
+/// written and the array isn't passed on as a pointer to non-const.
+/// \c std::arrays are only reported if they are const.
+class LocalConstantArrayCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_LOCAL_CONSTANT_ARRAY_CHECK_H
@@ -0,0 +1,30 @@
+//===--- Matchers.h - clang-tidy --------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_MATCHERS_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_MATCHERS_H
+
+#include "clang/ASTMatchers/ASTMatchers.h"
+
+namespace clang {
+namespace ast_matchers {
+
+/// \brief Matches functions that are instantiations of a template, including
+/// member functions of class template specializations.
+///
+/// Used as 'unless(hasAncestor(functionDecl(isInstantiatedFunction())))' to
+/// skip code whose fixes would have to be applied to the template pattern.
+AST_MATCHER(FunctionDecl, isInstantiatedFunction) {
+  return Node.isTemplateInstantiation();
+}
+
+} // namespace ast_matchers
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_MATCHERS_H
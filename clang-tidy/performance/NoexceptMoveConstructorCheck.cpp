@@ -0,0 +1,198 @@
+//===--- NoexceptMoveConstructorCheck.cpp - clang-tidy --------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "NoexceptMoveConstructorCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/TypeLoc.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+namespace {
+/// \brief \c RecursiveASTVisitor looking for expressions that may throw.
+///
+/// Conservative: calls through unknown callees or to functions that aren't
+/// known to be nothrow count as throwing.
+class ThrowingExprFinder : public RecursiveASTVisitor<ThrowingExprFinder> {
+public:
+  explicit ThrowingExprFinder(const ASTContext &Context)
+      : Context(Context), CanThrow(false) {}
+
+  bool VisitCXXThrowExpr(CXXThrowExpr *) { return found(); }
+  bool VisitCXXNewExpr(CXXNewExpr *) { return found(); }
+  bool VisitCXXTypeidExpr(CXXTypeidExpr *) { return found(); }
+
+  bool VisitCXXDynamicCastExpr(CXXDynamicCastExpr *E) {
+    if (E->getType()->isReferenceType())
+      return found();
+    return true;
+  }
+
+  bool VisitCallExpr(CallExpr *E) {
+    if (!isNothrow(E->getDirectCallee()))
+      return found();
+    return true;
+  }
+
+  bool VisitCXXConstructExpr(CXXConstructExpr *E) {
+    if (!isNothrow(E->getConstructor()))
+      return found();
+    return true;
+  }
+
+  bool canThrow() const { return CanThrow; }
+
+private:
+  bool isNothrow(const FunctionDecl *Function) const {
+    if (!Function)
+      return false;
+    if (Function->getBuiltinID())
+      return true;
+    const auto *Proto = Function->getType()->getAs<FunctionProtoType>();
+    return Proto && Proto->isNothrow(Context);
+  }
+
+  bool found() {
+    CanThrow = true;
+    return false;
+  }
+
+  const ASTContext &Context;
+  bool CanThrow;
+};
+} // namespace
+
+void NoexceptMoveConstructorCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(
+      methodDecl(anyOf(constructorDecl(), hasOverloadedOperatorName("=")))
+          .bind("decl"),
+      this);
+}
+
+/// \brief Whether the body of \p Definition, including the member
+/// initializers of a constructor, can't throw.
+static bool hasNonThrowingBody(const FunctionDecl &Definition,
+                               const ASTContext &Context) {
+  if (!Definition.getBody())
+    return false;
+  ThrowingExprFinder Finder(Context);
+  if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(&Definition)) {
+    for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+                                                 E = Ctor->init_end();
+         I != E; ++I) {
+      Finder.TraverseStmt((*I)->getInit());
+      if (Finder.canThrow())
+        return false;
+    }
+  }
+  Finder.TraverseStmt(Definition.getBody());
+  return !Finder.canThrow();
+}
+
+/// \brief Creates the fix adding 'noexcept' after the parameter list of
+/// \p Method. Returns \c false if this isn't possible.
+static bool makeNoexceptFix(const CXXMethodDecl &Method,
+                            const SourceManager &SM,
+                            const LangOptions &LangOpts,
+                            SmallVectorImpl<FixItHint> &Fixes) {
+  const TypeSourceInfo *TSI = Method.getTypeSourceInfo();
+  if (!TSI)
+    return false;
+  FunctionTypeLoc FTL =
+      TSI->getTypeLoc().IgnoreParens().getAs<FunctionTypeLoc>();
+  if (!FTL)
+    return false;
+  SourceLocation RParen = FTL.getRParenLoc();
+  if (RParen.isInvalid() || RParen.isMacroID())
+    return false;
+  Fixes.push_back(FixItHint::CreateInsertion(
+      Lexer::getLocForEndOfToken(RParen, 0, SM, LangOpts), " noexcept"));
+  return true;
+}
+
+void NoexceptMoveConstructorCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  const auto *Decl = Result.Nodes.getNodeAs<CXXMethodDecl>("decl");
+  if (Decl->isImplicit() || Decl->isDeleted())
+    return;
+  StringRef MethodType = "assignment operator";
+  if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(Decl)) {
+    if (!Ctor->isMoveConstructor())
+      return;
+    MethodType = "constructor";
+  } else if (!Decl->isMoveAssignmentOperator()) {
+    return;
+  }
+  // Report each function once, on its first declaration.
+  if (Decl != Decl->getCanonicalDecl() || Decl->isTemplateInstantiation() ||
+      Decl->getLocation().isMacroID())
+    return;
+
+  const auto *Proto = Decl->getType()->getAs<FunctionProtoType>();
+  if (!Proto)
+    return;
+  ASTContext &Context = *Result.Context;
+
+  switch (Proto->getExceptionSpecType()) {
+  case EST_None:
+  case EST_Dynamic:
+    break;
+  case EST_ComputedNoexcept:
+    // Don't complain about an explicit 'noexcept(false)', but do complain
+    // about 'noexcept(expr)' where 'expr' evaluates to 'false'.
+    if (Proto->getNoexceptSpec(Context) == FunctionProtoType::NR_Throw) {
+      const Expr *E = Proto->getNoexceptExpr();
+      if (!isa<CXXBoolLiteralExpr>(E->IgnoreParenImpCasts()))
+        diag(E->getExprLoc(),
+             "noexcept specifier on the move %0 evaluates to 'false'")
+            << MethodType;
+    }
+    return;
+  default:
+    // 'noexcept', 'throw()', and defaulted functions whose exception
+    // specification is computed from the members.
+    return;
+  }
+
+  DiagnosticBuilder Diag = diag(Decl->getLocation(),
+                                "move %0s should be marked noexcept")
+                           << MethodType;
+
+  // Only a function without exception specification can be fixed by adding
+  // one, and only if its body can't throw.
+  const FunctionDecl *Definition = nullptr;
+  if (Proto->getExceptionSpecType() != EST_None ||
+      Decl->getRefQualifier() != RQ_None || !Decl->hasBody(Definition) ||
+      Definition->isDefaulted() || !hasNonThrowingBody(*Definition, Context))
+    return;
+
+  // Fix all redeclarations or none of them.
+  SmallVector<FixItHint, 2> Fixes;
+  for (FunctionDecl::redecl_iterator I = Decl->redecls_begin(),
+                                     E = Decl->redecls_end();
+       I != E; ++I) {
+    if (!makeNoexceptFix(*cast<CXXMethodDecl>(*I), *Result.SourceManager,
+                         Context.getLangOpts(), Fixes))
+      return;
+  }
+  for (const FixItHint &Fix : Fixes)
+    Diag << Fix;
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
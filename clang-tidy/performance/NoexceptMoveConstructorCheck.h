@@ -0,0 +1,36 @@
+//===--- NoexceptMoveConstructorCheck.h - clang-tidy ------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_NOEXCEPT_MOVE_CONSTRUCTOR_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_NOEXCEPT_MOVE_CONSTRUCTOR_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds user-declared move constructors and move assignment operators
+/// that aren't \c noexcept, or whose \c noexcept expression evaluates to
+/// \c false.
+///
+/// Standard containers only move their elements on reallocation when this
+/// can't throw, and copy them otherwise. When the body can't throw, a fix
+/// adds \c noexcept to all declarations.
+class NoexceptMoveConstructorCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_NOEXCEPT_MOVE_CONSTRUCTOR_CHECK_H
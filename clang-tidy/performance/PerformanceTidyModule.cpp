@@ -0,0 +1,112 @@
+//===--- PerformanceTidyModule.cpp - clang-tidy ---------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "../ClangTidy.h"
+#include "../ClangTidyModule.h"
+#include "../ClangTidyModuleRegistry.h"
+#include "AllocationInLoopCheck.h"
+#include "AvoidEndlCheck.h"
+#include "ExpensiveLocalConstructionCheck.h"
+#include "FalseSharingCheck.h"
+#include "FasterStringFindCheck.h"
+#include "ForRangeCopyCheck.h"
+#include "ImplicitConversionInLoopCheck.h"
+#include "IneffectiveMoveCheck.h"
+#include "InefficientAlgorithmCheck.h"
+#include "InefficientStringConcatenationCheck.h"
+#include "InefficientVectorOperationCheck.h"
+#include "LocalConstantArrayCheck.h"
+#include "NoexceptMoveConstructorCheck.h"
+#include "RedundantLookupCheck.h"
+#include "RedundantStringCStrCheck.h"
+#include "SharedPtrParamCheck.h"
+#include "StructPaddingCheck.h"
+#include "UnnecessaryCopyInitializationCheck.h"
+#include "UnnecessaryValueParamCheck.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+class PerformanceModule : public ClangTidyModule {
+public:
+  void addCheckFactories(ClangTidyCheckFactories &CheckFactories) override {
+    CheckFactories.addCheckFactory(
+        "performance-allocation-in-loop",
+        new ClangTidyCheckFactory<AllocationInLoopCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-avoid-endl",
+        new ClangTidyCheckFactory<AvoidEndlCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-expensive-local-construction",
+        new ClangTidyCheckFactory<ExpensiveLocalConstructionCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-false-sharing",
+        new ClangTidyCheckFactory<FalseSharingCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-faster-string-find",
+        new ClangTidyCheckFactory<FasterStringFindCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-for-range-copy",
+        new ClangTidyCheckFactory<ForRangeCopyCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-implicit-conversion-in-loop",
+        new ClangTidyCheckFactory<ImplicitConversionInLoopCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-ineffective-move",
+        new ClangTidyCheckFactory<IneffectiveMoveCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-inefficient-algorithm",
+        new ClangTidyCheckFactory<InefficientAlgorithmCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-inefficient-string-concatenation",
+        new ClangTidyCheckFactory<InefficientStringConcatenationCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-inefficient-vector-operation",
+        new ClangTidyCheckFactory<InefficientVectorOperationCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-local-constant-array",
+        new ClangTidyCheckFactory<LocalConstantArrayCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-noexcept-move-constructor",
+        new ClangTidyCheckFactory<NoexceptMoveConstructorCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-redundant-lookup",
+        new ClangTidyCheckFactory<RedundantLookupCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-redundant-string-cstr",
+        new ClangTidyCheckFactory<RedundantStringCStrCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-shared-ptr-param",
+        new ClangTidyCheckFactory<SharedPtrParamCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-struct-padding",
+        new ClangTidyCheckFactory<StructPaddingCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-unnecessary-copy-initialization",
+        new ClangTidyCheckFactory<UnnecessaryCopyInitializationCheck>());
+    CheckFactories.addCheckFactory(
+        "performance-unnecessary-value-param",
+        new ClangTidyCheckFactory<UnnecessaryValueParamCheck>());
+  }
+};
+
+} // namespace performance
+
+// Register the PerformanceTidyModule using this statically initialized
+// variable.
+static ClangTidyModuleRegistry::Add<performance::PerformanceModule>
+X("performance-module", "Adds checks for runtime performance issues.");
+
+// This anchor is used to force the linker to link in the generated object file
+// and thus register the PerformanceModule.
+volatile int PerformanceModuleAnchorSource = 0;
+
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,304 @@
+//===--- RedundantLookupCheck.cpp - clang-tidy ----------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "RedundantLookupCheck.h"
+#include "DeclRefExprUtils.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/ADT/Twine.h"
+#include <algorithm>
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+namespace {
+enum ContainerKind { CK_None, CK_StdMap, CK_StdSet, CK_LLVMMap, CK_LLVMSet };
+
+bool isMap(ContainerKind Kind) {
+  return Kind == CK_StdMap || Kind == CK_LLVMMap;
+}
+
+/// \brief A call looking up a key in an associative container.
+struct Lookup {
+  const Expr *Call;
+  const Expr *Container;
+  const Expr *Key;
+  StringRef Method;
+  ContainerKind Kind;
+};
+
+ContainerKind getContainerKind(QualType Type) {
+  if (Type->isPointerType())
+    Type = Type->getPointeeType();
+  const CXXRecordDecl *Record = Type->getAsCXXRecordDecl();
+  if (!Record)
+    return CK_None;
+  return llvm::StringSwitch<ContainerKind>(Record->getQualifiedNameAsString())
+      .Cases("std::map", "std::unordered_map", CK_StdMap)
+      .Cases("std::set", "std::unordered_set", CK_StdSet)
+      .Cases("llvm::DenseMap", "llvm::StringMap", CK_LLVMMap)
+      .Case("llvm::DenseSet", CK_LLVMSet)
+      .Default(CK_None);
+}
+
+/// \brief Whether \p Method looks up its first argument. Inserting into a map
+/// takes a key-value pair, whose key isn't compared.
+bool isLookupMethod(StringRef Method, ContainerKind Kind) {
+  return llvm::StringSwitch<bool>(Method)
+      .Cases("count", "find", "lookup", "at", "erase", "emplace", true)
+      .Case("operator[]", isMap(Kind))
+      .Case("insert", !isMap(Kind))
+      .Default(false);
+}
+
+bool getLookup(const Expr *E, Lookup &Result) {
+  const CXXMethodDecl *Method = nullptr;
+  if (const auto *Call = dyn_cast<CXXMemberCallExpr>(E)) {
+    if (Call->getNumArgs() < 1)
+      return false;
+    Method = Call->getMethodDecl();
+    Result.Container = Call->getImplicitObjectArgument();
+    Result.Key = Call->getArg(0);
+  } else if (const auto *OpCall = dyn_cast<CXXOperatorCallExpr>(E)) {
+    if (OpCall->getOperator() != OO_Subscript || OpCall->getNumArgs() != 2)
+      return false;
+    Method = dyn_cast_or_null<CXXMethodDecl>(OpCall->getDirectCallee());
+    Result.Container = OpCall->getArg(0);
+    Result.Key = OpCall->getArg(1);
+  } else {
+    return false;
+  }
+  if (!Method || !Result.Container)
+    return false;
+  Result.Call = E;
+  if (Method->getOverloadedOperator() == OO_Subscript)
+    Result.Method = "operator[]";
+  else if (Method->getIdentifier())
+    Result.Method = Method->getName();
+  else
+    return false;
+  Result.Kind = getContainerKind(Result.Container->getType());
+  return Result.Kind != CK_None && isLookupMethod(Result.Method, Result.Kind);
+}
+
+/// \brief \c RecursiveASTVisitor collecting container lookups in source
+/// order.
+class LookupCollector : public RecursiveASTVisitor<LookupCollector> {
+public:
+  explicit LookupCollector(SmallVectorImpl<Lookup> &Lookups)
+      : Lookups(Lookups) {}
+
+  bool VisitCXXMemberCallExpr(CXXMemberCallExpr *E) { return add(E); }
+  bool VisitCXXOperatorCallExpr(CXXOperatorCallExpr *E) { return add(E); }
+
+private:
+  bool add(const Expr *E) {
+    Lookup L;
+    if (getLookup(E, L))
+      Lookups.push_back(L);
+    return true;
+  }
+
+  SmallVectorImpl<Lookup> &Lookups;
+};
+
+/// \brief \c RecursiveASTVisitor collecting all expressions naming a variable
+/// or a field.
+class ReferenceCollector : public RecursiveASTVisitor<ReferenceCollector> {
+public:
+  ReferenceCollector(const ValueDecl *D, SmallVectorImpl<const Expr *> &Refs)
+      : D(D), Refs(Refs) {}
+
+  bool VisitDeclRefExpr(DeclRefExpr *E) {
+    if (E->getDecl() == D)
+      Refs.push_back(E);
+    return true;
+  }
+
+  bool VisitMemberExpr(MemberExpr *E) {
+    if (E->getMemberDecl() == D)
+      Refs.push_back(E);
+    return true;
+  }
+
+private:
+  const ValueDecl *D;
+  SmallVectorImpl<const Expr *> &Refs;
+};
+} // namespace
+
+/// \brief Strips conversions, temporaries and converting constructors, e.g.
+/// the construction of a \c std::string from a literal.
+static const Expr *ignoreConversions(const Expr *E) {
+  while (true) {
+    E = E->IgnoreParenImpCasts();
+    if (const auto *Temp = dyn_cast<MaterializeTemporaryExpr>(E))
+      E = Temp->GetTemporaryExpr();
+    else if (const auto *Bind = dyn_cast<CXXBindTemporaryExpr>(E))
+      E = Bind->getSubExpr();
+    else if (const auto *Construct = dyn_cast<CXXConstructExpr>(E)) {
+      if (Construct->getNumArgs() != 1)
+        return E;
+      E = Construct->getArg(0);
+    } else
+      return E;
+  }
+}
+
+/// \brief Whether \p A and \p B are spelled the same and denote the same
+/// object or value. Only variables, members and literals are compared.
+static bool areSameExpr(const Expr *A, const Expr *B) {
+  A = ignoreConversions(A);
+  B = ignoreConversions(B);
+  if (A->getStmtClass() != B->getStmtClass())
+    return false;
+  if (const auto *RefA = dyn_cast<DeclRefExpr>(A))
+    return RefA->getDecl() == cast<DeclRefExpr>(B)->getDecl();
+  if (const auto *MemberA = dyn_cast<MemberExpr>(A)) {
+    const auto *MemberB = cast<MemberExpr>(B);
+    return MemberA->getMemberDecl() == MemberB->getMemberDecl() &&
+           MemberA->isArrow() == MemberB->isArrow() &&
+           areSameExpr(MemberA->getBase(), MemberB->getBase());
+  }
+  if (isa<CXXThisExpr>(A))
+    return true;
+  if (const auto *IntA = dyn_cast<IntegerLiteral>(A))
+    return IntA->getValue() == cast<IntegerLiteral>(B)->getValue();
+  if (const auto *CharA = dyn_cast<CharacterLiteral>(A))
+    return CharA->getValue() == cast<CharacterLiteral>(B)->getValue();
+  if (const auto *StrA = dyn_cast<StringLiteral>(A))
+    return StrA->getBytes() == cast<StringLiteral>(B)->getBytes();
+  return false;
+}
+
+/// \brief Returns the variable or field an expression accepted by
+/// \c areSameExpr() is rooted in, or null for literals.
+static const ValueDecl *getReferencedDecl(const Expr *E) {
+  E = ignoreConversions(E);
+  if (const auto *Ref = dyn_cast<DeclRefExpr>(E))
+    return Ref->getDecl();
+  if (const auto *Member = dyn_cast<MemberExpr>(E))
+    return Member->getMemberDecl();
+  return nullptr;
+}
+
+/// \brief Whether \p Ref is the object of a call to a non-const container
+/// method that doesn't modify the container, e.g. 'M.end()'.
+static bool isNonMutatingCall(const Expr &Ref, const ParentMap &Parents) {
+  const auto *Member = dyn_cast_or_null<MemberExpr>(
+      Parents.getParentIgnoreParenImpCasts(const_cast<Expr *>(&Ref)));
+  if (!Member || !isa<CXXMethodDecl>(Member->getMemberDecl()) ||
+      !Member->getMemberDecl()->getIdentifier())
+    return false;
+  return llvm::StringSwitch<bool>(Member->getMemberDecl()->getName())
+      .Cases("begin", "end", "find", "count", "lookup", true)
+      .Cases("equal_range", "lower_bound", "upper_bound", true)
+      .Default(false);
+}
+
+/// \brief Whether \p D may be modified in \p S before \p Loc, not counting the
+/// uses in \p Allowed.
+static bool isModifiedBefore(const ValueDecl *D, const Stmt &S,
+                             SourceLocation Loc, ArrayRef<const Expr *> Allowed,
+                             const SourceManager &SM) {
+  if (!D)
+    return false;
+  SmallVector<const Expr *, 8> Refs;
+  ReferenceCollector(D, Refs).TraverseStmt(const_cast<Stmt *>(&S));
+  ParentMap Parents(const_cast<Stmt *>(&S));
+  for (const Expr *Ref : Refs) {
+    if (!SM.isBeforeInTranslationUnit(Ref->getLocStart(), Loc) ||
+        std::find(Allowed.begin(), Allowed.end(), Ref) != Allowed.end())
+      continue;
+    if (!isConstUse(*Ref, Parents) && !isNonMutatingCall(*Ref, Parents))
+      return true;
+  }
+  return false;
+}
+
+void RedundantLookupCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(
+      ifStmt(unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("if"),
+      this);
+}
+
+void RedundantLookupCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *If = Result.Nodes.getNodeAs<IfStmt>("if");
+  if (!If->getCond() || If->getLocStart().isMacroID())
+    return;
+
+  SmallVector<Lookup, 4> CondLookups;
+  LookupCollector(CondLookups).TraverseStmt(const_cast<Expr *>(If->getCond()));
+  if (CondLookups.empty())
+    return;
+  // Later lookups, in source order: the rest of the condition, then the
+  // branches.
+  SmallVector<Lookup, 8> Lookups(CondLookups.begin(), CondLookups.end());
+  LookupCollector(Lookups).TraverseStmt(const_cast<Stmt *>(If->getThen()));
+  if (If->getElse())
+    LookupCollector(Lookups).TraverseStmt(const_cast<Stmt *>(If->getElse()));
+
+  const SourceManager &SM = *Result.SourceManager;
+  for (unsigned I = 0, E = CondLookups.size(); I != E; ++I) {
+    const Lookup &First = CondLookups[I];
+    if (First.Method != "count" && First.Method != "find")
+      continue;
+    for (unsigned J = I + 1, F = Lookups.size(); J != F; ++J) {
+      const Lookup &Second = Lookups[J];
+      if (!areSameExpr(First.Container, Second.Container) ||
+          !areSameExpr(First.Key, Second.Key))
+        continue;
+      SourceLocation Loc = Second.Call->getLocStart();
+      if (Loc.isMacroID())
+        return;
+
+      // The first lookup must still be valid when the second one happens.
+      const Expr *ContainerUses[] = {ignoreConversions(First.Container),
+                                     ignoreConversions(Second.Container)};
+      if (isModifiedBefore(getReferencedDecl(First.Container), *If, Loc,
+                           ContainerUses, SM) ||
+          isModifiedBefore(getReferencedDecl(First.Key), *If, Loc, None, SM))
+        return;
+
+      StringRef Suggestion;
+      if (Second.Method == "insert" || Second.Method == "emplace")
+        Suggestion = "consider calling only '%1' and using the 'bool' member "
+                     "of the pair it returns";
+      else if (First.Kind == CK_LLVMMap && First.Method == "count" &&
+               Second.Method != "erase")
+        Suggestion = "consider using 'lookup' or saving the iterator returned "
+                     "by 'find'";
+      else
+        Suggestion = "consider saving the iterator returned by 'find' and "
+                     "reusing it";
+
+      diag(Loc, (llvm::Twine("the same key is looked up again in the "
+                             "container by '%1' after '%0'; ") +
+                 Suggestion).str())
+          << First.Method << Second.Method;
+      diag(First.Call->getLocStart(), "first lookup is here",
+           DiagnosticIDs::Note);
+      return;
+    }
+  }
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
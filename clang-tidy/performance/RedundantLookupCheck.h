@@ -0,0 +1,45 @@
+//===--- RedundantLookupCheck.h - clang-tidy --------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_LOOKUP_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_LOOKUP_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds 'if' statements that look up a key in an associative
+/// container in their condition and look up the same key in the same
+/// container again in the condition or the branches, without modifying either
+/// in between.
+///
+/// Example:
+/// \code
+///   if (M.count(K))            // Looks up K.
+///     return M[K];             // Looks up K again.
+///   if (!S.count(K))           // Looks up K.
+///     S.insert(K);             // Looks up K again; use insert(K).second.
+/// \endcode
+///
+/// Handled containers are \c std::map, \c std::set, \c std::unordered_map,
+/// \c std::unordered_set, \c llvm::DenseMap, \c llvm::DenseSet and
+/// \c llvm::StringMap.
+class RedundantLookupCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_LOOKUP_CHECK_H
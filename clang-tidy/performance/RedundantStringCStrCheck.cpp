@@ -0,0 +1,194 @@
+//===--- RedundantStringCStrCheck.cpp - clang-tidy ------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "RedundantStringCStrCheck.h"
+#include "Matchers.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void RedundantStringCStrCheck::registerMatchers(MatchFinder *Finder) {
+  const auto StringClass = recordDecl(hasName("::std::basic_string"));
+  Finder->addMatcher(
+      memberCallExpr(
+          callee(methodDecl(hasName("c_str"), ofClass(StringClass))),
+          argumentCountIs(0),
+          unless(hasAncestor(functionDecl(isInstantiatedFunction()))))
+          .bind("call"),
+      this);
+}
+
+/// \brief Whether \p Record is, or derives from, one of the classes named
+/// \p Name1 or \p Name2.
+static bool isOrDerivesFrom(const CXXRecordDecl *Record, StringRef Name1,
+                            StringRef Name2) {
+  if (!Record || !Record->hasDefinition())
+    return false;
+  std::string Name = Record->getQualifiedNameAsString();
+  if (Name == Name1 || Name == Name2)
+    return true;
+  Record = Record->getDefinition();
+  for (CXXRecordDecl::base_class_const_iterator I = Record->bases_begin(),
+                                                E = Record->bases_end();
+       I != E; ++I) {
+    if (isOrDerivesFrom(I->getType()->getAsCXXRecordDecl(), Name1, Name2))
+      return true;
+  }
+  return false;
+}
+
+/// \brief Whether \p Arg is the last argument written in \p Call, i.e. all
+/// arguments after it are default arguments.
+template <typename CallT>
+static bool isLastWrittenArgument(const CallT &Call, const Expr *Arg) {
+  for (unsigned I = 0, N = Call.getNumArgs(); I != N; ++I) {
+    if (Call.getArg(I) != Arg)
+      continue;
+    for (unsigned J = I + 1; J != N; ++J) {
+      if (!isa<CXXDefaultArgExpr>(Call.getArg(J)))
+        return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+/// \brief Whether the string \p StringType can be used instead of the
+/// character pointer \p Arg where it is used in \p User.
+static bool acceptsString(const Stmt &User, const Expr *Arg,
+                          QualType StringType, ASTContext &Context) {
+  // Constructions of strings of the same type, StringRef and Twine, which
+  // have constructors from strings as well.
+  if (const auto *Construct = dyn_cast<CXXConstructExpr>(&User)) {
+    if (Construct->getNumArgs() < 1 || Construct->getArg(0) != Arg ||
+        !isLastWrittenArgument(*Construct, Arg))
+      return false;
+    const CXXRecordDecl *Record = Construct->getConstructor()->getParent();
+    std::string Name = Record->getQualifiedNameAsString();
+    if (Name == "llvm::StringRef" || Name == "llvm::Twine")
+      return true;
+    return Name == "std::basic_string" &&
+           Context.hasSameUnqualifiedType(Construct->getType(), StringType);
+  }
+
+  // Streams have an operator<< for strings.
+  if (const auto *OpCall = dyn_cast<CXXOperatorCallExpr>(&User)) {
+    return OpCall->getOperator() == OO_LessLess && OpCall->getNumArgs() == 2 &&
+           OpCall->getArg(1) == Arg &&
+           isOrDerivesFrom(OpCall->getArg(0)->getType()->getAsCXXRecordDecl(),
+                           "std::basic_ostream", "llvm::raw_ostream");
+  }
+
+  // 'append' and 'compare' have string overloads for their last argument.
+  if (const auto *MemberCall = dyn_cast<CXXMemberCallExpr>(&User)) {
+    const CXXMethodDecl *Method = MemberCall->getMethodDecl();
+    if (!Method || !Method->getIdentifier() ||
+        (Method->getName() != "append" && Method->getName() != "compare"))
+      return false;
+    const Expr *Object = MemberCall->getImplicitObjectArgument();
+    QualType ObjectType = Object->getType();
+    if (ObjectType->isPointerType())
+      ObjectType = ObjectType->getPointeeType();
+    return Method->getParent()->getQualifiedNameAsString() ==
+               "std::basic_string" &&
+           Context.hasSameUnqualifiedType(ObjectType, StringType) &&
+           isLastWrittenArgument(*MemberCall, Arg);
+  }
+  return false;
+}
+
+/// \brief Whether \p E needs parentheses as the operand of a prefix unary
+/// operator.
+static bool needParensAfterUnaryOperator(const Expr &E) {
+  if (isa<BinaryOperator>(E) || isa<ConditionalOperator>(E))
+    return true;
+  if (const auto *Op = dyn_cast<CXXOperatorCallExpr>(&E)) {
+    return Op->getNumArgs() == 2 && Op->getOperator() != OO_PlusPlus &&
+           Op->getOperator() != OO_MinusMinus && Op->getOperator() != OO_Call &&
+           Op->getOperator() != OO_Subscript;
+  }
+  return false;
+}
+
+static StringRef getText(const Expr &E, const SourceManager &SM,
+                         const LangOptions &LangOpts) {
+  return Lexer::getSourceText(
+      CharSourceRange::getTokenRange(E.getSourceRange()), SM, LangOpts);
+}
+
+/// \brief Returns the text of the string object of a 'P->c_str()' call: '*P',
+/// or 'S' if \p Pointer is '&S'.
+static std::string formatDereference(const Expr &Pointer,
+                                     const SourceManager &SM,
+                                     const LangOptions &LangOpts) {
+  if (const auto *Op = dyn_cast<UnaryOperator>(&Pointer)) {
+    if (Op->getOpcode() == UO_AddrOf)
+      return getText(*Op->getSubExpr()->IgnoreParens(), SM, LangOpts);
+  }
+  StringRef Text = getText(Pointer, SM, LangOpts);
+  if (Text.empty())
+    return std::string();
+  if (needParensAfterUnaryOperator(Pointer))
+    return ("*(" + Text + ")").str();
+  return ("*" + Text).str();
+}
+
+void RedundantStringCStrCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Call = Result.Nodes.getNodeAs<CXXMemberCallExpr>("call");
+  const auto *Member = dyn_cast<MemberExpr>(Call->getCallee()->IgnoreParens());
+  if (!Member || Member->isImplicitAccess() ||
+      Call->getLocStart().isMacroID() || Call->getLocEnd().isMacroID())
+    return;
+
+  // Find the expression using the character pointer.
+  ASTContext &Context = *Result.Context;
+  const Expr *Arg = Call;
+  const Stmt *User = nullptr;
+  while (true) {
+    auto Parents = Context.getParents(*Arg);
+    if (Parents.empty())
+      return;
+    User = Parents[0].get<Stmt>();
+    const auto *Cast = dyn_cast_or_null<ImplicitCastExpr>(User);
+    if (!Cast || Cast->getCastKind() != CK_NoOp)
+      break;
+    Arg = Cast;
+  }
+  const Expr *Object = Member->getBase()->IgnoreParenImpCasts();
+  QualType StringType = Object->getType();
+  if (Member->isArrow())
+    StringType = StringType->getPointeeType();
+  if (!User || !acceptsString(*User, Arg, StringType, Context))
+    return;
+
+  const SourceManager &SM = *Result.SourceManager;
+  const LangOptions &LangOpts = Context.getLangOpts();
+  std::string ObjectText = Member->isArrow()
+                               ? formatDereference(*Object, SM, LangOpts)
+                               : getText(*Object, SM, LangOpts).str();
+  if (ObjectText.empty())
+    return;
+  diag(Call->getLocStart(),
+       "redundant call to 'c_str()'; using the string directly avoids "
+       "recomputing its length")
+      << FixItHint::CreateReplacement(
+             CharSourceRange::getTokenRange(Call->getSourceRange()),
+             ObjectText);
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
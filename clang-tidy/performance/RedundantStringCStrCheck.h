@@ -0,0 +1,47 @@
+//===--- RedundantStringCStrCheck.h - clang-tidy ----------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_STRING_CSTR_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_STRING_CSTR_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds calls to \c std::string::c_str() whose result is turned back
+/// into a string-like object, which recomputes the length with \c strlen and
+/// often copies the characters.
+///
+/// Example:
+/// \code
+///   void f(const std::string &);
+///   f(S.c_str());                  ==>  f(S);
+///   llvm::StringRef R(P->c_str()); ==>  llvm::StringRef R(*P);
+///   OS << S.c_str();               ==>  OS << S;
+///   S.append(T.c_str());           ==>  S.append(T);
+/// \endcode
+///
+/// Handles constructions of \c std::basic_string of the same type,
+/// \c llvm::StringRef and \c llvm::Twine, the right operand of \c operator<<
+/// on \c std::basic_ostream and \c llvm::raw_ostream, and the last argument
+/// of \c append and \c compare. This is the analysis of the standalone
+/// remove-cstr-calls tool, extended to more patterns.
+class RedundantStringCStrCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_REDUNDANT_STRING_CSTR_CHECK_H
@@ -0,0 +1,151 @@
+//===--- SharedPtrParamCheck.cpp - clang-tidy -----------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "SharedPtrParamCheck.h"
+#include "DeclRefExprUtils.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/ParentMap.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void SharedPtrParamCheck::registerMatchers(MatchFinder *Finder) {
+  Finder->addMatcher(parmVarDecl().bind("param"), this);
+}
+
+/// \brief Whether the use \p Ref of a \c shared_ptr only accesses the
+/// pointee. Sets \p UsesNull if the use observes whether it is null.
+static bool isPointeeUse(const DeclRefExpr &Ref, const ParentMap &Parents,
+                         bool &UsesNull) {
+  // Lambdas may capture a copy.
+  for (const Stmt *S = Parents.getParent(&Ref); S; S = Parents.getParent(S)) {
+    if (isa<LambdaExpr>(S))
+      return false;
+  }
+
+  const Stmt *Child = &Ref;
+  const Stmt *Parent = Parents.getParent(Child);
+  while (Parent) {
+    const auto *Cast = dyn_cast<ImplicitCastExpr>(Parent);
+    if (!isa<ParenExpr>(Parent) && (!Cast || Cast->getCastKind() != CK_NoOp))
+      break;
+    Child = Parent;
+    Parent = Parents.getParent(Child);
+  }
+  if (!Parent)
+    return false;
+
+  if (const auto *OpCall = dyn_cast<CXXOperatorCallExpr>(Parent)) {
+    switch (OpCall->getOperator()) {
+    case OO_Star:
+    case OO_Arrow:
+      return OpCall->getNumArgs() == 1;
+    case OO_EqualEqual:
+    case OO_ExclaimEqual:
+      UsesNull = true;
+      return true;
+    default:
+      return false;
+    }
+  }
+  if (const auto *Member = dyn_cast<MemberExpr>(Parent)) {
+    const ValueDecl *MemberDecl = Member->getMemberDecl();
+    if (isa<CXXConversionDecl>(MemberDecl)) {
+      UsesNull = true;
+      return true;
+    }
+    if (MemberDecl->getIdentifier() && MemberDecl->getName() == "get") {
+      UsesNull = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// \brief Whether every reference to \p Param within \p S is a
+/// \c isPointeeUse().
+static bool isOnlyDereferenced(const ParmVarDecl &Param, const Stmt &S,
+                               bool &UsesNull) {
+  llvm::SmallVector<const DeclRefExpr *, 8> Refs;
+  collectDeclRefs(Param, S, Refs);
+  if (Refs.empty())
+    return true;
+  ParentMap Parents(const_cast<Stmt *>(&S));
+  for (const DeclRefExpr *Ref : Refs) {
+    if (!isPointeeUse(*Ref, Parents, UsesNull))
+      return false;
+  }
+  return true;
+}
+
+void SharedPtrParamCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Param = Result.Nodes.getNodeAs<ParmVarDecl>("param");
+  const auto *Function = dyn_cast<FunctionDecl>(Param->getDeclContext());
+  if (!Function || !Function->doesThisDeclarationHaveABody() ||
+      !Function->getBody() || Function->isImplicit() ||
+      Function->isTemplateInstantiation() || !Param->getIdentifier() ||
+      Param->getLocation().isMacroID())
+    return;
+  const auto *Method = dyn_cast<CXXMethodDecl>(Function);
+  if (Method && Method->isVirtual())
+    return;
+
+  const auto *SharedPtr = dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+      Param->getType()->getAsCXXRecordDecl());
+  if (Param->getType()->isReferenceType() || !SharedPtr ||
+      SharedPtr->getQualifiedNameAsString() != "std::shared_ptr" ||
+      SharedPtr->getTemplateArgs().size() < 1 ||
+      SharedPtr->getTemplateArgs()[0].getKind() != TemplateArgument::Type)
+    return;
+
+  bool UsesNull = false;
+  if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(Function)) {
+    for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+                                                 E = Ctor->init_end();
+         I != E; ++I) {
+      if ((*I)->isWritten() &&
+          !isOnlyDereferenced(*Param, *(*I)->getInit(), UsesNull))
+        return;
+    }
+  }
+  // Unused parameters are left to other checks.
+  llvm::SmallVector<const DeclRefExpr *, 8> Refs;
+  collectDeclRefs(*Param, *Function->getBody(), Refs);
+  if (Refs.empty() ||
+      !isOnlyDereferenced(*Param, *Function->getBody(), UsesNull))
+    return;
+
+  QualType Pointee = SharedPtr->getTemplateArgs()[0].getAsType();
+  if (UsesNull) {
+    diag(Param->getLocation(),
+         "parameter %0 is a 'shared_ptr' passed by value, which updates the "
+         "reference count on every call, but the function doesn't share the "
+         "ownership; consider passing a %1 or a const reference to the "
+         "'shared_ptr'")
+        << Param << Result.Context->getPointerType(Pointee);
+    return;
+  }
+  diag(Param->getLocation(),
+       "parameter %0 is a 'shared_ptr' passed by value, which updates the "
+       "reference count on every call, but the function only uses the "
+       "pointee; consider passing a %1 or a %2")
+      << Param << Result.Context->getLValueReferenceType(Pointee)
+      << Result.Context->getPointerType(Pointee);
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
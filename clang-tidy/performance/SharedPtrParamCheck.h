@@ -0,0 +1,44 @@
+//===--- SharedPtrParamCheck.h - clang-tidy ---------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_SHARED_PTR_PARAM_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_SHARED_PTR_PARAM_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds \c std::shared_ptr parameters passed by value to functions
+/// that only use the pointed-to object, paying for two atomic reference count
+/// updates per call without taking part in the ownership.
+///
+/// Example:
+/// \code
+///   int size(std::shared_ptr<Buffer> B) { return B->size(); }
+///   // consider: int size(const Buffer &B);
+/// \endcode
+///
+/// A parameter is reported when it is only dereferenced, converted to
+/// \c bool, compared or passed to \c get(); copying, moving, storing or
+/// resetting it takes part in the ownership. When the null state is used the
+/// check suggests a raw pointer or a const reference to the \c shared_ptr.
+/// Virtual functions are skipped, as their signature is fixed by the base.
+class SharedPtrParamCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_SHARED_PTR_PARAM_CHECK_H
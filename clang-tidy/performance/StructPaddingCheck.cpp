@@ -0,0 +1,134 @@
+//===--- StructPaddingCheck.cpp - clang-tidy ------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "StructPaddingCheck.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Attr.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/RecordLayout.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "llvm/ADT/SmallVector.h"
+#include <algorithm>
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+StructPaddingCheck::StructPaddingCheck() : Threshold(0) {}
+
+void StructPaddingCheck::registerMatchers(MatchFinder *Finder) {
+  Threshold = getOption("Threshold", Threshold);
+  Finder->addMatcher(recordDecl().bind("record"), this);
+}
+
+namespace {
+struct FieldInfo {
+  const FieldDecl *Field;
+  CharUnits Size;
+  CharUnits Align;
+};
+
+/// \brief Orders fields by decreasing alignment, which leaves no padding
+/// between them as every size is a multiple of the alignment.
+struct ByDecreasingAlignment {
+  bool operator()(const FieldInfo &LHS, const FieldInfo &RHS) const {
+    return LHS.Align > RHS.Align;
+  }
+};
+} // namespace
+
+/// \brief Whether reordering the fields of \p Record may change its meaning
+/// or can't be modeled by laying out the fields one after another.
+static bool isReorderable(const RecordDecl &Record, const SourceManager &SM) {
+  if (!Record.isThisDeclarationADefinition() || Record.isInvalidDecl() ||
+      Record.isImplicit() || Record.isUnion() || Record.isDependentType() ||
+      Record.hasFlexibleArrayMember())
+    return false;
+  if (Record.getLocation().isInvalid() ||
+      SM.isInSystemHeader(Record.getLocation()))
+    return false;
+  // Instantiations are laid out like their pattern.
+  if (isa<ClassTemplateSpecializationDecl>(Record))
+    return false;
+  // Packed records and records shared with C code have a fixed layout.
+  if (Record.hasAttr<PackedAttr>() || Record.hasAttr<MaxFieldAlignmentAttr>() ||
+      Record.getDeclContext()->isExternCContext())
+    return false;
+  if (const auto *CXXRecord = dyn_cast<CXXRecordDecl>(&Record)) {
+    if (CXXRecord->isLambda() || CXXRecord->getNumBases() != 0 ||
+        CXXRecord->getNumVBases() != 0 || CXXRecord->isDynamicClass())
+      return false;
+  }
+  for (RecordDecl::field_iterator I = Record.field_begin(),
+                                  E = Record.field_end();
+       I != E; ++I) {
+    if (I->isBitField() || I->isAnonymousStructOrUnion() ||
+        I->hasAttr<PackedAttr>() || !I->getIdentifier())
+      return false;
+  }
+  return true;
+}
+
+void StructPaddingCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Record = Result.Nodes.getNodeAs<RecordDecl>("record");
+  if (!isReorderable(*Record, *Result.SourceManager))
+    return;
+
+  ASTContext &Context = *Result.Context;
+  SmallVector<FieldInfo, 8> Fields;
+  for (RecordDecl::field_iterator I = Record->field_begin(),
+                                  E = Record->field_end();
+       I != E; ++I) {
+    QualType Type = I->getType();
+    // References are stored as pointers.
+    if (const auto *Ref = Type->getAs<ReferenceType>())
+      Type = Context.getPointerType(Ref->getPointeeType());
+    if (Type->isIncompleteType() || Type->isDependentType())
+      return;
+    FieldInfo Info = {*I, Context.getTypeSizeInChars(Type),
+                      Context.getDeclAlign(*I)};
+    Fields.push_back(Info);
+  }
+  if (Fields.size() < 2)
+    return;
+
+  const ASTRecordLayout &Layout = Context.getASTRecordLayout(Record);
+  std::stable_sort(Fields.begin(), Fields.end(), ByDecreasingAlignment());
+  CharUnits Offset = CharUnits::Zero();
+  for (const FieldInfo &Info : Fields)
+    Offset = Offset.RoundUpToAlignment(Info.Align) + Info.Size;
+  CharUnits OptimalSize = Offset.RoundUpToAlignment(Layout.getAlignment());
+  CharUnits CurrentSize = Layout.getSize();
+  if (OptimalSize >= CurrentSize)
+    return;
+  unsigned Saved =
+      static_cast<unsigned>((CurrentSize - OptimalSize).getQuantity());
+  if (Saved <= Threshold)
+    return;
+
+  std::string Order;
+  for (const FieldInfo &Info : Fields) {
+    if (!Order.empty())
+      Order += ", ";
+    Order += Info.Field->getNameAsString();
+  }
+  diag(Record->getLocation(),
+       "%0 is %1 bytes but would be %2 bytes if its fields were reordered to "
+       "minimize padding (saving %3 bytes); consider the order: %4")
+      << Record << static_cast<unsigned>(CurrentSize.getQuantity())
+      << static_cast<unsigned>(OptimalSize.getQuantity())
+      << Saved << Order;
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
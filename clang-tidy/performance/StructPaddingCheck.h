@@ -0,0 +1,47 @@
+//===--- StructPaddingCheck.h - clang-tidy ----------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_STRUCT_PADDING_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_STRUCT_PADDING_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds record definitions whose size could shrink by reordering their
+/// fields, and suggests the order that minimizes padding.
+///
+/// Example:
+/// \code
+///   struct S { char A; double B; char C; };  // 24 bytes
+///   struct S { double B; char A; char C; };  // 16 bytes
+/// \endcode
+///
+/// Only records that would shrink by more than the "Threshold" option (in
+/// bytes, 0 by default) are reported. Records with bit-fields, base classes,
+/// virtual functions, packing, flexible array members or C language linkage
+/// are skipped, as are unions and records in system headers.
+class StructPaddingCheck : public ClangTidyCheck {
+public:
+  StructPaddingCheck();
+
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  unsigned Threshold;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_STRUCT_PADDING_CHECK_H
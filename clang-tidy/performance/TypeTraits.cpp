@@ -0,0 +1,35 @@
+//===--- TypeTraits.cpp - clang-tidy --------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TypeTraits.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+bool isExpensiveToCopy(QualType Type, ASTContext &Context) {
+  if (Type.isNull() || Type->isDependentType() || Type->isIncompleteType())
+    return false;
+  return !Type.isTriviallyCopyableType(Context);
+}
+
+bool isInTemplateInstantiation(const Decl &D) {
+  for (const DeclContext *DC = D.getDeclContext(); DC; DC = DC->getParent()) {
+    if (const auto *Function = dyn_cast<FunctionDecl>(DC))
+      if (Function->isTemplateInstantiation())
+        return true;
+  }
+  return false;
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,38 @@
+//===--- TypeTraits.h - clang-tidy ------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_TYPE_TRAITS_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_TYPE_TRAITS_H
+
+#include "clang/AST/Type.h"
+
+namespace clang {
+class ASTContext;
+class Decl;
+
+namespace tidy {
+namespace performance {
+
+/// \brief Returns \c true if copying a value of \p Type runs user code or
+/// allocates, i.e. the type is complete, not dependent and not trivially
+/// copyable.
+bool isExpensiveToCopy(QualType Type, ASTContext &Context);
+
+/// \brief Returns \c true if \p D is declared inside a function that is an
+/// instantiation of a template.
+///
+/// Checks that offer fixes skip such declarations, as the fix would have to be
+/// applied to the template pattern instead.
+bool isInTemplateInstantiation(const Decl &D);
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_TYPE_TRAITS_H
@@ -0,0 +1,113 @@
+//===--- UnnecessaryCopyInitializationCheck.cpp - clang-tidy --------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnnecessaryCopyInitializationCheck.h"
+#include "DeclRefExprUtils.h"
+#include "TypeTraits.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+void UnnecessaryCopyInitializationCheck::registerMatchers(MatchFinder *Finder) {
+  // Only single declarations, so that the fix can't change the type of other
+  // variables declared in the same statement.
+  Finder->addMatcher(declStmt(hasSingleDecl(varDecl().bind("var"))), this);
+}
+
+/// \brief Returns the local variable (or parameter) \p E refers to, if any.
+static const VarDecl *getReferencedLocal(const Expr *E) {
+  const auto *Ref = dyn_cast<DeclRefExpr>(E->IgnoreParenImpCasts());
+  if (!Ref)
+    return nullptr;
+  const auto *Var = dyn_cast<VarDecl>(Ref->getDecl());
+  if (!Var || !Var->hasLocalStorage())
+    return nullptr;
+  return Var;
+}
+
+void UnnecessaryCopyInitializationCheck::check(
+    const MatchFinder::MatchResult &Result) {
+  const auto *Var = Result.Nodes.getNodeAs<VarDecl>("var");
+  if (!Var->isLocalVarDecl() || !Var->hasLocalStorage() ||
+      Var->isCXXForRangeDecl() || Var->getLocation().isMacroID() ||
+      isInTemplateInstantiation(*Var))
+    return;
+
+  QualType Type = Var->getType();
+  if (Type->isReferenceType() || !isExpensiveToCopy(Type, *Result.Context))
+    return;
+
+  const Expr *Init = Var->getInit();
+  if (!Init)
+    return;
+  const auto *Construct = dyn_cast<CXXConstructExpr>(Init->IgnoreImplicit());
+  if (!Construct || Construct->getNumArgs() < 1 ||
+      !Construct->getConstructor()->isCopyConstructor())
+    return;
+
+  const auto *Function = dyn_cast<FunctionDecl>(Var->getDeclContext());
+  if (!Function || !Function->hasBody())
+    return;
+  const Stmt &Body = *Function->getBody();
+
+  const Expr *Source = Construct->getArg(0)->IgnoreParenImpCasts();
+  const VarDecl *SourceVar = nullptr;
+  if (const auto *Call = dyn_cast<CallExpr>(Source)) {
+    const FunctionDecl *Callee = Call->getDirectCallee();
+    if (!Callee)
+      return;
+    QualType ReturnType = Callee->getReturnType();
+    if (!ReturnType->isLValueReferenceType() ||
+        !ReturnType->getPointeeType().isConstQualified())
+      return;
+    // The object a getter is called on must not change while the reference
+    // is alive. This can only be verified for local objects, and not for the
+    // objects local pointers point to.
+    if (const auto *MemberCall = dyn_cast<CXXMemberCallExpr>(Call)) {
+      const Expr *ObjectArg = MemberCall->getImplicitObjectArgument();
+      const VarDecl *Object = getReferencedLocal(ObjectArg);
+      if (!Object || ObjectArg->getType()->isPointerType() ||
+          !isOnlyUsedAsConst(*Object, Body))
+        return;
+    }
+  } else {
+    SourceVar = getReferencedLocal(Source);
+    if (!SourceVar || !isOnlyUsedAsConst(*SourceVar, Body))
+      return;
+  }
+
+  if (!isOnlyUsedAsConst(*Var, Body))
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(Var->getLocation(),
+           SourceVar ? "variable %0 is a copy of %1 but neither is ever "
+                       "modified; consider making it a const reference"
+                     : "variable %0 is copy-initialized from a const "
+                       "reference but never modified; consider making it a "
+                       "const reference")
+      << Var;
+  if (SourceVar)
+    Diag << SourceVar;
+  if (Var->getLocStart().isMacroID())
+    return;
+  if (!Type.isConstQualified())
+    Diag << FixItHint::CreateInsertion(Var->getLocStart(), "const ");
+  Diag << FixItHint::CreateInsertion(Var->getLocation(), "&");
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,42 @@
+//===--- UnnecessaryCopyInitializationCheck.h - clang-tidy ------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_COPY_INITIALIZATION_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_COPY_INITIALIZATION_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds local variables that are copy-initialized from a const
+/// reference returned by a call, or from another local variable, and are never
+/// modified afterwards.
+///
+/// Example:
+/// \code
+///   const std::string Name = Obj.getName();
+///   ==>
+///   const std::string &Name = Obj.getName();
+/// \endcode
+///
+/// The source of the copy must not be modified either, so that the reference
+/// keeps seeing the same value the copy would have had.
+class UnnecessaryCopyInitializationCheck : public ClangTidyCheck {
+public:
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_COPY_INITIALIZATION_CHECK_H
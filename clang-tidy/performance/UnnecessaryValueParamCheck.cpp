@@ -0,0 +1,131 @@
+//===--- UnnecessaryValueParamCheck.cpp - clang-tidy ----------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnnecessaryValueParamCheck.h"
+#include "DeclRefExprUtils.h"
+#include "TypeTraits.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/ASTMatchers/ASTMatchFinder.h"
+#include "clang/Lex/Lexer.h"
+
+using namespace clang::ast_matchers;
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+UnnecessaryValueParamCheck::UnnecessaryValueParamCheck() : SizeThreshold(64) {}
+
+void UnnecessaryValueParamCheck::registerMatchers(MatchFinder *Finder) {
+  SizeThreshold = getOption("SizeThreshold", SizeThreshold);
+  Finder->addMatcher(parmVarDecl().bind("param"), this);
+}
+
+/// \brief Whether \p Param is only read in the body of \p Function, including
+/// the member initializers of a constructor.
+static bool isOnlyReadIn(const ParmVarDecl &Param,
+                         const FunctionDecl &Function) {
+  if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(&Function)) {
+    for (CXXConstructorDecl::init_const_iterator I = Ctor->init_begin(),
+                                                 E = Ctor->init_end();
+         I != E; ++I) {
+      if ((*I)->isWritten() && !isOnlyUsedAsConst(Param, *(*I)->getInit()))
+        return false;
+    }
+  }
+  return isOnlyUsedAsConst(Param, *Function.getBody());
+}
+
+/// \brief Creates the fixes turning the parameter \p Param into a const
+/// reference. Returns \c false if this isn't possible.
+static bool makeConstRefFixes(const ParmVarDecl &Param,
+                              const SourceManager &SM,
+                              const LangOptions &LangOpts,
+                              SmallVectorImpl<FixItHint> &Fixes) {
+  const TypeSourceInfo *TSI = Param.getTypeSourceInfo();
+  if (!TSI)
+    return false;
+  TypeLoc TL = TSI->getTypeLoc();
+  SourceLocation TypeBegin = TL.getBeginLoc();
+  SourceLocation TypeEnd = TL.getEndLoc();
+  if (TypeBegin.isInvalid() || TypeBegin.isMacroID() || TypeEnd.isMacroID() ||
+      Param.getLocation().isMacroID())
+    return false;
+
+  if (!Param.getType().isConstQualified())
+    Fixes.push_back(FixItHint::CreateInsertion(TypeBegin, "const "));
+  if (Param.getIdentifier()) {
+    Fixes.push_back(FixItHint::CreateInsertion(Param.getLocation(), "&"));
+  } else {
+    Fixes.push_back(FixItHint::CreateInsertion(
+        Lexer::getLocForEndOfToken(TypeEnd, 0, SM, LangOpts), " &"));
+  }
+  return true;
+}
+
+void UnnecessaryValueParamCheck::check(const MatchFinder::MatchResult &Result) {
+  const auto *Param = Result.Nodes.getNodeAs<ParmVarDecl>("param");
+  const auto *Function = dyn_cast<FunctionDecl>(Param->getDeclContext());
+  if (!Function || !Function->doesThisDeclarationHaveABody() ||
+      !Function->getBody() || Function->isImplicit() ||
+      Function->isTemplateInstantiation() ||
+      Param->getLocation().isMacroID())
+    return;
+
+  // Copy and move operations need their parameters by value or reference for
+  // their semantics, whatever the body does.
+  if (const auto *Method = dyn_cast<CXXMethodDecl>(Function)) {
+    if (Method->isCopyAssignmentOperator() || Method->isMoveAssignmentOperator())
+      return;
+    if (const auto *Ctor = dyn_cast<CXXConstructorDecl>(Method))
+      if (Ctor->isCopyOrMoveConstructor())
+        return;
+  }
+
+  QualType Type = Param->getType();
+  if (Type->isReferenceType() || Type->isPointerType() ||
+      Type->isDependentType() || Type->isIncompleteType())
+    return;
+  ASTContext &Context = *Result.Context;
+  bool IsExpensive =
+      isExpensiveToCopy(Type, Context) ||
+      (SizeThreshold > 0 &&
+       Context.getTypeSizeInChars(Type).getQuantity() > SizeThreshold);
+  if (!IsExpensive || !isOnlyReadIn(*Param, *Function))
+    return;
+
+  DiagnosticBuilder Diag =
+      diag(Param->getLocation(),
+           "parameter %0 is passed by value and copied on every call, but "
+           "only read; consider passing it as a const reference")
+      << Param;
+
+  const auto *Method = dyn_cast<CXXMethodDecl>(Function);
+  if (Method && Method->isVirtual())
+    return;
+
+  // Fix all redeclarations or none of them.
+  unsigned Index = Param->getFunctionScopeIndex();
+  SmallVector<FixItHint, 8> Fixes;
+  for (FunctionDecl::redecl_iterator I = Function->redecls_begin(),
+                                     E = Function->redecls_end();
+       I != E; ++I) {
+    if (Index >= I->getNumParams() ||
+        !makeConstRefFixes(*I->getParamDecl(Index), *Result.SourceManager,
+                           Context.getLangOpts(), Fixes))
+      return;
+  }
+  for (const FixItHint &Fix : Fixes)
+    Diag << Fix;
+}
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
@@ -0,0 +1,48 @@
+//===--- UnnecessaryValueParamCheck.h - clang-tidy --------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_VALUE_PARAM_CHECK_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_VALUE_PARAM_CHECK_H
+
+#include "../ClangTidy.h"
+
+namespace clang {
+namespace tidy {
+namespace performance {
+
+/// \brief Finds parameters of function definitions that are passed by value,
+/// are expensive to copy and are only read by the function body.
+///
+/// A type is expensive to copy if it is not trivially copyable, or if it is
+/// larger than the "SizeThreshold" option (in bytes, 64 by default, 0 turns the
+/// size limit off).
+///
+/// Example:
+/// \code
+///   void f(std::vector<int> V);  ==>  void f(const std::vector<int> &V);
+/// \endcode
+///
+/// Fixes are applied to all redeclarations of the function. Virtual functions
+/// are not changed, as that would break overriding.
+class UnnecessaryValueParamCheck : public ClangTidyCheck {
+public:
+  UnnecessaryValueParamCheck();
+
+  void registerMatchers(ast_matchers::MatchFinder *Finder) override;
+  void check(const ast_matchers::MatchFinder::MatchResult &Result) override;
+
+private:
+  unsigned SizeThreshold;
+};
+
+} // namespace performance
+} // namespace tidy
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANG_TIDY_PERFORMANCE_UNNECESSARY_VALUE_PARAM_CHECK_H
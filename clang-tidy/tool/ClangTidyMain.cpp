@@ -63,6 +63,15 @@ LineFilter("line-filter",
                     "  ]"),
            cl::init(""), cl::cat(ClangTidyCategory));
 
+static cl::opt<std::string>
+Config("config",
+       cl::desc("Specifies a configuration in YAML/JSON format:\n"
+                "  -config=\"{Checks: '*', CheckOptions: [{key: x,\n"
+                "             value: y}]}\"\n"
+                "-checks and -header-filter are applied on top of\n"
+                "this configuration."),
+       cl::init(""), cl::cat(ClangTidyCategory));
+
 static cl::opt<bool> Fix("fix", cl::desc("Fix detected errors if possible."),
                          cl::init(false), cl::cat(ClangTidyCategory));
 
@@ -117,9 +126,20 @@ int main(int argc, const char **argv) {
   }
 
   clang::tidy::ClangTidyOptions Options;
-  Options.Checks = DefaultChecks + Checks;
-  Options.HeaderFilterRegex = HeaderFilter;
-  Options.AnalyzeTemporaryDtors = AnalyzeTemporaryDtors;
+  Options.Checks.clear();
+  if (std::error_code Err = clang::tidy::parseConfiguration(Config, Options)) {
+    llvm::errs() << "Invalid configuration: " << Err.message()
+                 << "\n\nUsage:\n";
+    llvm::cl::PrintHelpMessage(/*Hidden=*/false, /*Categorized=*/true);
+    return 1;
+  }
+  if (!Options.Checks.empty())
+    Options.Checks += ",";
+  Options.Checks = DefaultChecks + Options.Checks + Checks;
+  if (!HeaderFilter.empty())
+    Options.HeaderFilterRegex = HeaderFilter;
+  if (AnalyzeTemporaryDtors)
+    Options.AnalyzeTemporaryDtors = true;
 
   std::vector<std::string> EnabledChecks = clang::tidy::getCheckNames(Options);
 
@@ -166,5 +186,9 @@ static int GoogleModuleAnchorDestination = GoogleModuleAnchorSource;
 extern volatile int MiscModuleAnchorSource;
 static int MiscModuleAnchorDestination = MiscModuleAnchorSource;
 
+// This anchor is used to force the linker to link the PerformanceModule.
+extern volatile int PerformanceModuleAnchorSource;
+static int PerformanceModuleAnchorDestination = PerformanceModuleAnchorSource;
+
 } // namespace tidy
 } // namespace clang
@@ -8,7 +8,8 @@
 //===----------------------------------------------------------------------===//
 //
 //  This file implements a tool that prints replacements that remove redundant
-//  calls of c_str() on strings.
+//  calls of c_str() on strings. The clang-tidy check
+//  performance-redundant-string-cstr covers the same patterns and more.
 //
 //  Usage:
 //  remove-cstr-calls <cmake-output-dir> <file1> <file2> ...
@@ -0,0 +1,12 @@
+namespace std {
+template <typename T> struct shared_ptr {
+  shared_ptr();
+  template <typename Y> explicit shared_ptr(Y *);
+  template <typename Y, typename D> shared_ptr(Y *, D);
+  template <typename Y> shared_ptr(const shared_ptr<Y> &);
+  template <typename Y> void reset(Y *);
+  T *operator->() const;
+};
+
+template <typename T, typename... Args> shared_ptr<T> make_shared(Args &&...);
+} // namespace std
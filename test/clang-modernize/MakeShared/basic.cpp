@@ -0,0 +1,73 @@
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-modernize -make-shared %t.cpp -- -std=c++11 -I %S
+// RUN: FileCheck -input-file=%t.cpp %s
+//
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-modernize -make-shared -risk=safe %t.cpp -- -std=c++11 -I %S
+// RUN: FileCheck -check-prefix=SAFE_RISK -input-file=%t.cpp %s
+
+#include "Inputs/shared_ptr_stub.h"
+// CHECK: #include <memory>
+// SAFE_RISK-NOT: #include <memory>
+
+struct Foo {
+  Foo();
+  Foo(int, int);
+  Foo(int *);
+};
+
+struct Derived : Foo {};
+
+class Private {
+  Private();
+  friend void f(int);
+};
+
+struct CustomNew {
+  static void *operator new(unsigned long);
+};
+
+struct Holder {
+  std::shared_ptr<Foo> P;
+};
+
+void deleter(Foo *);
+
+void f(int X) {
+  std::shared_ptr<Foo> A = std::shared_ptr<Foo>(new Foo(X, 2));
+  // CHECK: std::shared_ptr<Foo> A = std::make_shared<Foo>(X, 2);
+  // SAFE_RISK: std::shared_ptr<Foo> A = std::shared_ptr<Foo>(new Foo(X, 2));
+  std::shared_ptr<Foo> B = std::shared_ptr<Foo>(new Foo);
+  // CHECK: std::shared_ptr<Foo> B = std::make_shared<Foo>();
+  std::shared_ptr<int> I = std::shared_ptr<int>(new int(X));
+  // CHECK: std::shared_ptr<int> I = std::make_shared<int>(X);
+
+  A.reset(new Foo(X, 3));
+  // CHECK: A = std::make_shared<Foo>(X, 3);
+  Holder H;
+  Holder *PH = &H;
+  PH->P.reset(new Foo());
+  // CHECK: PH->P = std::make_shared<Foo>();
+  std::shared_ptr<Foo> *PA = &A;
+  PA->reset(new Foo(1, 2));
+  // CHECK: *PA = std::make_shared<Foo>(1, 2);
+
+  // Custom deleter.
+  std::shared_ptr<Foo> C = std::shared_ptr<Foo>(new Foo, deleter);
+  // CHECK: std::shared_ptr<Foo> C = std::shared_ptr<Foo>(new Foo, deleter);
+  // Other type than the pointee type.
+  std::shared_ptr<Foo> D = std::shared_ptr<Foo>(new Derived);
+  // CHECK: std::shared_ptr<Foo> D = std::shared_ptr<Foo>(new Derived);
+  // Non-public constructor.
+  std::shared_ptr<Private> E = std::shared_ptr<Private>(new Private);
+  // CHECK: std::shared_ptr<Private> E = std::shared_ptr<Private>(new Private);
+  // Class-specific operator new.
+  std::shared_ptr<CustomNew> F = std::shared_ptr<CustomNew>(new CustomNew);
+  // CHECK: std::shared_ptr<CustomNew> F = std::shared_ptr<CustomNew>(new CustomNew);
+  // Arguments that can't be forwarded.
+  A.reset(new Foo(0));
+  // CHECK: A.reset(new Foo(0));
+  // Braced initialization.
+  A.reset(new Foo{X, 4});
+  // CHECK: A.reset(new Foo{X, 4});
+}
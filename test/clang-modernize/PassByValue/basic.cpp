@@ -183,3 +183,72 @@ struct S {
   // CHECK: S(Movable &&M) : M(M) {}
   Movable M;
 };
+
+struct NotMoveAssignable {
+  NotMoveAssignable &operator=(const NotMoveAssignable &) = default;
+  NotMoveAssignable &operator=(NotMoveAssignable &&) = delete;
+  int a;
+};
+
+// Test setters and other member functions assigning a parameter to a field
+struct T {
+  void setM(const Movable &NewM) { M = NewM; }
+  // CHECK: void setM(Movable NewM) { M = std::move(NewM); }
+
+  T &withM(const Movable &NewM) {
+    this->M = NewM;
+    return *this;
+  }
+  // CHECK:      T &withM(Movable NewM) {
+  // CHECK-NEXT:   this->M = std::move(NewM);
+
+  // Test that a parameter with more than one reference to it won't be changed.
+  void setBoth(const Movable &NewM) { M = NewM; Other = NewM; }
+  // CHECK: void setBoth(const Movable &NewM) { M = NewM; Other = NewM; }
+
+  // Test that an assignment which may run more than once isn't changed.
+  void setInLoop(const Movable &NewM) {
+    for (int i = 0; i < 2; ++i)
+      M = NewM;
+  }
+  // CHECK: void setInLoop(const Movable &NewM) {
+
+  // Test that a non-member isn't changed.
+  void setLocal(const Movable &NewM) {
+    Movable Local;
+    Local = NewM;
+  }
+  // CHECK: void setLocal(const Movable &NewM) {
+
+  // Test with object that can't be move assigned
+  void setNMA(const NotMoveAssignable &NewNMA) { NMA = NewNMA; }
+  // CHECK: void setNMA(const NotMoveAssignable &NewNMA) { NMA = NewNMA; }
+
+  // Test that virtual functions aren't changed
+  virtual void setVirtual(const Movable &NewM) { M = NewM; }
+  // CHECK: virtual void setVirtual(const Movable &NewM) { M = NewM; }
+
+  // Test that setters with an rvalue reference overload aren't changed, the
+  // calls with rvalues would be ambiguous.
+  void setOverloaded(const Movable &NewM) { M = NewM; }
+  // CHECK: void setOverloaded(const Movable &NewM) { M = NewM; }
+  void setOverloaded(Movable &&NewM) { M = static_cast<Movable &&>(NewM); }
+
+  // Test that both declaration and definition are updated
+  void setOutOfLine(const Movable &NewM);
+  // CHECK: void setOutOfLine(Movable NewM);
+
+  Movable M;
+  Movable Other;
+  NotMoveAssignable NMA;
+};
+void T::setOutOfLine(const Movable &NewM) { M = NewM; }
+// CHECK: void T::setOutOfLine(Movable NewM) { M = std::move(NewM); }
+
+// Test that setters of templates aren't modified
+template <typename U> struct V {
+  void setM(const U &NewM) { M = NewM; }
+  // CHECK: void setM(const U &NewM) { M = NewM; }
+  U M;
+};
+V<Movable> v;
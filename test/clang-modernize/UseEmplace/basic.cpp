@@ -0,0 +1,99 @@
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-modernize -use-emplace %t.cpp -- -std=c++11
+// RUN: FileCheck -input-file=%t.cpp %s
+//
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-modernize -use-emplace -risk=safe %t.cpp -- -std=c++11
+// RUN: FileCheck -check-prefix=SAFE_RISK -input-file=%t.cpp %s
+
+namespace std {
+template <typename T1, typename T2> struct pair {
+  pair(const T1 &, const T2 &);
+  template <typename U1, typename U2> pair(const pair<U1, U2> &);
+  T1 first;
+  T2 second;
+};
+
+template <typename T1, typename T2>
+pair<T1, T2> make_pair(T1 a, T2 b) {
+  return pair<T1, T2>(a, b);
+}
+
+template <typename T> struct vector {
+  void push_back(const T &);
+  void push_back(T &&);
+  template <typename... Args> void emplace_back(Args &&... args);
+};
+
+template <typename T> struct set {
+  void push_back(const T &);
+  void push_back(T &&);
+  template <typename... Args> void emplace_back(Args &&... args);
+};
+} // namespace std
+
+struct Point {
+  Point();
+  Point(int X, int Y = 0);
+  int X, Y;
+};
+
+struct Explicit {
+  explicit Explicit(int);
+};
+
+struct Ptr {
+  Ptr(int *);
+};
+
+struct BitField {
+  unsigned B : 2;
+};
+
+void f(int X, int Y, const Point &P) {
+  std::vector<Point> Points;
+  Points.push_back(Point(X, Y));
+  // CHECK: Points.emplace_back(X, Y);
+  // SAFE_RISK: Points.push_back(Point(X, Y));
+  Points.push_back(Point( X ));
+  // CHECK: Points.emplace_back(X);
+  Points.push_back(Point());
+  // CHECK: Points.emplace_back();
+
+  std::vector<std::pair<int, int> > Pairs;
+  Pairs.push_back(std::make_pair(X, Y));
+  // CHECK: Pairs.emplace_back(X, Y);
+  Pairs.push_back(std::pair<int, int>(X, Y));
+  // CHECK: Pairs.emplace_back(X, Y);
+
+  // Not a temporary, or not exactly of the element type.
+  Points.push_back(P);
+  // CHECK: Points.push_back(P);
+  Points.push_back(X);
+  // CHECK: Points.push_back(X);
+  Points.push_back(Point(P));
+  // CHECK: Points.push_back(Point(P));
+  Points.push_back(Point{X, Y});
+  // CHECK: Points.push_back(Point{X, Y});
+  std::vector<std::pair<long, int> > LongPairs;
+  LongPairs.push_back(std::make_pair(X, Y));
+  // CHECK: LongPairs.push_back(std::make_pair(X, Y));
+
+  // Explicit constructors.
+  std::vector<Explicit> Explicits;
+  Explicits.push_back(Explicit(X));
+  // CHECK: Explicits.push_back(Explicit(X));
+
+  // Arguments that can't be forwarded.
+  std::vector<Ptr> Ptrs;
+  Ptrs.push_back(Ptr(0));
+  // CHECK: Ptrs.push_back(Ptr(0));
+  BitField BF;
+  Points.push_back(Point(BF.B));
+  // CHECK: Points.push_back(Point(BF.B));
+
+  // Not a standard sequence container.
+  std::set<Point> Set;
+  Set.push_back(Point(X, Y));
+  // CHECK: Set.push_back(Point(X, Y));
+}
@@ -0,0 +1,107 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-allocation-in-loop
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+T &&move(T &);
+
+template <typename T>
+struct vector {
+  vector();
+  explicit vector(unsigned);
+  vector(vector &&);
+  ~vector();
+  void push_back(const T &);
+  unsigned size() const;
+  T &operator[](unsigned);
+  void swap(vector &);
+};
+
+template <typename T>
+struct unique_ptr {
+  explicit unique_ptr(T *);
+  unique_ptr(unique_ptr &&);
+  ~unique_ptr();
+  T *operator->() const;
+  T *release();
+};
+
+template <typename T, typename Arg>
+unique_ptr<T> make_unique(Arg &&);
+} // namespace std
+
+struct Buf {
+  explicit Buf(int);
+  int Size;
+};
+
+void fill(std::vector<int> &);
+void use(const std::vector<int> &);
+void use(int);
+std::vector<int> compute(int);
+
+void f(int N) {
+  for (int I = 0; I < N; ++I) {
+    std::vector<int> Scratch;
+    // CHECK: :[[@LINE-1]]:22: warning: 'Scratch' allocates memory that is freed at the end of every loop iteration; consider declaring it before the loop and clearing it in each iteration to reuse its storage [performance-allocation-in-loop]
+    fill(Scratch);
+    use(Scratch);
+  }
+
+  while (N--) {
+    std::vector<int> Sized(N);
+    // CHECK: :[[@LINE-1]]:22: warning: 'Sized' allocates memory
+    use(Sized);
+    auto P = std::make_unique<Buf>(N);
+    // CHECK: :[[@LINE-1]]:10: warning: the object owned by 'P' is allocated and freed in every loop iteration; consider allocating it once before the loop and reusing it [performance-allocation-in-loop]
+    use(P->Size);
+    std::unique_ptr<Buf> Q(new Buf(N));
+    // CHECK: :[[@LINE-1]]:26: warning: the object owned by 'Q'
+    use(Q->Size);
+    Buf *R = new Buf(N);
+    // CHECK: :[[@LINE-1]]:10: warning: the object owned by 'R'
+    use(R->Size);
+    delete R;
+  }
+}
+
+// CHECK-NOT: warning:
+std::vector<int> g(int N, std::vector<std::vector<int> > &Out,
+                   std::vector<std::unique_ptr<Buf> > &Owners) {
+  for (int I = 0; I < N; ++I) {
+    // Never filled, so never allocates.
+    std::vector<int> Empty;
+    use(Empty);
+
+    // Takes over the storage of the returned vector.
+    std::vector<int> Computed = compute(I);
+    use(Computed);
+
+    // Moved, swapped or returned: the memory outlives the iteration.
+    std::vector<int> Moved;
+    fill(Moved);
+    Out.push_back(std::move(Moved));
+    std::vector<int> Swapped;
+    fill(Swapped);
+    Out[0].swap(Swapped);
+    std::vector<int> Returned;
+    fill(Returned);
+    if (Returned.size() > 3)
+      return Returned;
+
+    auto P = std::make_unique<Buf>(N);
+    Owners.push_back(std::move(P));
+    std::unique_ptr<Buf> Released(new Buf(N));
+    Buf *Raw = Released.release();
+    delete Raw;
+
+    // Not deleted here, or copied before being deleted.
+    Buf *Leaked = new Buf(N);
+    use(Leaked->Size);
+    Buf *Copied = new Buf(N);
+    Buf *Alias = Copied;
+    delete Copied;
+    use(Alias->Size);
+  }
+  return std::vector<int>();
+}
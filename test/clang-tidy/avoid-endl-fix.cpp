@@ -0,0 +1,41 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-avoid-endl %t
+// REQUIRES: shell
+
+namespace std {
+template <typename CharT>
+struct char_traits {};
+
+template <typename CharT, typename Traits = char_traits<CharT> >
+struct basic_ostream {
+  basic_ostream &operator<<(int);
+  basic_ostream &operator<<(basic_ostream &(*)(basic_ostream &));
+};
+typedef basic_ostream<char> ostream;
+
+template <typename CharT, typename Traits>
+basic_ostream<CharT, Traits> &endl(basic_ostream<CharT, Traits> &);
+
+template <typename CharT, typename Traits>
+basic_ostream<CharT, Traits> &operator<<(basic_ostream<CharT, Traits> &,
+                                         char);
+
+extern ostream cout;
+} // namespace std
+
+void f(std::ostream &OS, int N) {
+  for (int I = 0; I < N; ++I)
+    OS << I << std::endl;
+  // CHECK: {{^    OS << I << '\\n';$}}
+  while (N--) {
+    std::cout << N << std::endl;
+    // CHECK: {{^    std::cout << N << '\\n';$}}
+  }
+  do
+    OS << std::endl;
+  while (N++ < 10);
+  // CHECK: {{^    OS << '\\n';$}}
+
+  // Outside of loops.
+  OS << N << std::endl;
+  // CHECK: {{^  OS << N << std::endl;$}}
+}
@@ -0,0 +1,30 @@
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-tidy %t.cpp -fix -checks=-*,performance-avoid-endl -config="{CheckOptions: [{key: performance-avoid-endl.StrictMode, value: 1}]}" -- -std=c++11
+// RUN: FileCheck -input-file=%t.cpp %s -strict-whitespace
+
+namespace std {
+template <typename CharT>
+struct char_traits {};
+
+template <typename CharT, typename Traits = char_traits<CharT> >
+struct basic_ostream {
+  basic_ostream &operator<<(int);
+  basic_ostream &operator<<(basic_ostream &(*)(basic_ostream &));
+};
+typedef basic_ostream<char> ostream;
+
+template <typename CharT, typename Traits>
+basic_ostream<CharT, Traits> &endl(basic_ostream<CharT, Traits> &);
+} // namespace std
+
+using std::endl;
+
+void f(std::ostream &OS, int N) {
+  OS << N << std::endl;
+  // CHECK: {{^  OS << N << '\\n';$}}
+  OS << endl;
+  // CHECK: {{^  OS << '\\n';$}}
+  // Not streamed.
+  std::endl(OS);
+  // CHECK: {{^  std::endl\(OS\);$}}
+}
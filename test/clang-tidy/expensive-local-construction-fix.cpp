@@ -0,0 +1,74 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-expensive-local-construction %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+struct initializer_list {
+  const T *Begin;
+  unsigned long Size;
+};
+
+template <typename CharT>
+struct basic_string {
+  basic_string(const CharT *);
+  ~basic_string();
+};
+typedef basic_string<char> string;
+
+template <typename CharT>
+struct basic_regex {
+  enum flag_type { icase = 1 };
+  basic_regex(const CharT *, flag_type = icase);
+  ~basic_regex();
+};
+typedef basic_regex<char> regex;
+bool regex_match(const string &, const regex &);
+
+template <typename A, typename B>
+struct pair {
+  pair(const A &, const B &);
+};
+
+template <typename K, typename V>
+struct map {
+  map();
+  map(initializer_list<pair<const K, V> >);
+  ~map();
+  V &operator[](const K &);
+  unsigned count(const K &) const;
+};
+} // namespace std
+
+static const char *const Pattern = "[0-9]+";
+
+bool isIdentifier(const std::string &S) {
+  std::regex Identifier("[a-z_]+", std::regex::icase);
+  // CHECK: {{^  static const std::regex Identifier\("\[a-z_\]\+", std::regex::icase\);$}}
+  const std::regex Number(Pattern);
+  // CHECK: {{^  static const std::regex Number\(Pattern\);$}}
+  return std::regex_match(S, Identifier) || std::regex_match(S, Number);
+}
+
+unsigned lookup(int Key) {
+  const std::map<int, const char *> Names = {{1, "one"}, {2, "two"}};
+  // CHECK: {{^  static const std::map<int, const char \*> Names = }}
+  return Names.count(Key);
+}
+
+void negatives(const char *Dynamic, int Key) {
+  std::regex FromArgument(Dynamic);
+  // CHECK: {{^  std::regex FromArgument\(Dynamic\);$}}
+  std::regex_match("x", FromArgument);
+
+  std::map<int, int> Modified = {{1, 2}};
+  // CHECK: {{^  std::map<int, int> Modified = }}
+  Modified[Key] = 3;
+
+  std::map<int, int> Empty;
+  // CHECK: {{^  std::map<int, int> Empty;$}}
+  Empty.count(Key);
+
+  static const std::regex AlreadyStatic("a");
+  // CHECK: {{^  static const std::regex AlreadyStatic\("a"\);$}}
+  std::regex_match("a", AlreadyStatic);
+}
@@ -0,0 +1,46 @@
+// RUN: clang-tidy -checks=-*,performance-false-sharing %s -- -std=c++11 -target x86_64-unknown-unknown | FileCheck %s
+// RUN: clang-tidy -checks=-*,performance-false-sharing -config="{CheckOptions: [{key: performance-false-sharing.CacheLineSize, value: 128}]}" %s -- -std=c++11 -target x86_64-unknown-unknown | FileCheck -check-prefix=LINE128 %s
+
+namespace std {
+template <typename T>
+struct atomic {
+  T Value;
+};
+struct mutex {
+  long Storage[5];
+};
+} // namespace std
+
+struct Stats {
+  std::atomic<long> Hits;
+  std::atomic<long> Misses;
+  // CHECK: :[[@LINE-1]]:21: warning: 'Misses' may share a 64-byte cache line with 'Hits'; writes to them from different threads cause false sharing; consider aligning 'Misses' with 'alignas(64)' or inserting padding [performance-false-sharing]
+};
+
+struct Queue {
+  std::mutex Lock;
+  char Buffer[60];
+  std::atomic<int> Size;
+  // CHECK: :[[@LINE-1]]:20: warning: 'Size' may share a 64-byte cache line with 'Lock'
+  // LINE128: :[[@LINE-2]]:20: warning: 'Size' may share a 128-byte cache line with 'Lock'
+  std::atomic<int> PerThread[8];
+  // CHECK: :[[@LINE-1]]:20: warning: elements of 'PerThread' share 64-byte cache lines; writes to different elements from different threads cause false sharing; consider wrapping the element type in a struct aligned with 'alignas(64)' [performance-false-sharing]
+  // CHECK: :[[@LINE-2]]:20: warning: 'PerThread' may share a 64-byte cache line with 'Size'
+};
+
+// CHECK-NOT: warning:
+struct alignas(64) Aligned {
+  std::atomic<long> Head;
+  char Pad[56];
+  std::atomic<long> Tail;
+};
+
+struct Separated {
+  alignas(64) std::atomic<long> Head;
+  alignas(64) std::atomic<long> Tail;
+};
+
+struct Single {
+  std::atomic<long> Count;
+  long Other;
+};
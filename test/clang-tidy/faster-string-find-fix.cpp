@@ -0,0 +1,63 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-faster-string-find %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+class basic_string {
+public:
+  typedef unsigned size_type;
+  size_type find(const T *S, size_type Pos = 0) const;
+  size_type find(const T *S, size_type Pos, size_type N) const;
+  size_type find(T C, size_type Pos = 0) const;
+  size_type rfind(const T *S, size_type Pos = 0) const;
+  size_type rfind(T C, size_type Pos = 0) const;
+  size_type find_first_of(const T *S, size_type Pos = 0) const;
+  size_type find_first_of(T C, size_type Pos = 0) const;
+};
+typedef basic_string<char> string;
+} // namespace std
+
+namespace llvm {
+class StringRef {
+public:
+  StringRef(const char *);
+  unsigned find(char C, unsigned From = 0) const;
+  unsigned find(StringRef S, unsigned From = 0) const;
+  unsigned find_last_of(char C, unsigned From = 0) const;
+  unsigned find_last_of(StringRef Chars, unsigned From = 0) const;
+};
+} // namespace llvm
+
+struct NotAString {
+  unsigned find(const char *) const;
+};
+
+void f(const std::string &S, llvm::StringRef R, NotAString N) {
+  S.find("x");
+  // CHECK: {{^  S.find\('x'\);$}}
+  S.rfind("/", 3);
+  // CHECK: {{^  S.rfind\('/', 3\);$}}
+  S.find_first_of(":");
+  // CHECK: {{^  S.find_first_of\(':'\);$}}
+  S.find("'");
+  // CHECK: {{^  S.find\('\\''\);$}}
+  S.find("\"");
+  // CHECK: {{^  S.find\('"'\);$}}
+  S.find("\n");
+  // CHECK: {{^  S.find\('\\n'\);$}}
+  R.find("x");
+  // CHECK: {{^  R.find\('x'\);$}}
+  R.find_last_of("/");
+  // CHECK: {{^  R.find_last_of\('/'\);$}}
+
+  S.find("xy");
+  // CHECK: {{^  S.find\("xy"\);$}}
+  S.find("\0");
+  // CHECK: {{^  S.find\("\\0"\);$}}
+  S.find("x", 0, 1);
+  // CHECK: {{^  S.find\("x", 0, 1\);$}}
+  S.find('x');
+  // CHECK: {{^  S.find\('x'\);$}}
+  N.find("x");
+  // CHECK: {{^  N.find\("x"\);$}}
+}
@@ -0,0 +1,34 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-for-range-copy %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+struct vector {
+  T *begin();
+  T *end();
+};
+} // namespace std
+
+struct Expensive {
+  Expensive(const Expensive &);
+  ~Expensive();
+  int size() const;
+  void clear();
+};
+
+int f(std::vector<Expensive> &V) {
+  int Total = 0;
+  for (Expensive E : V)
+    Total += E.size();
+  // CHECK: {{^  for \(const Expensive &E : V\)$}}
+  for (auto E : V)
+    Total += E.size();
+  // CHECK: {{^  for \(const auto &E : V\)$}}
+  for (const Expensive E : V)
+    Total += E.size();
+  // CHECK: {{^  for \(const Expensive &E : V\)$}}
+  for (Expensive E : V)
+    E.clear();
+  // CHECK: {{^  for \(Expensive E : V\)$}}
+  return Total;
+}
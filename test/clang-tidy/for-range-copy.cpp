@@ -0,0 +1,74 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-for-range-copy
+// REQUIRES: shell
+
+// CHECK-NOT: warning
+
+namespace std {
+template <typename T>
+struct vector {
+  T *begin();
+  T *end();
+  const T *begin() const;
+  const T *end() const;
+};
+} // namespace std
+
+struct Expensive {
+  Expensive();
+  Expensive(const Expensive &);
+  ~Expensive();
+  int size() const;
+  void clear();
+};
+
+struct Cheap {
+  int X, Y;
+};
+
+void useConst(const Expensive &);
+void useMutable(Expensive &);
+
+int positive(std::vector<Expensive> &V, const std::vector<Expensive> &CV) {
+  int Total = 0;
+  for (Expensive E : V)
+    Total += E.size();
+  // CHECK: :[[@LINE-2]]:18: warning: loop variable 'E' is copied in each iteration but only read; consider making it a const reference [performance-for-range-copy]
+
+  for (auto E : CV)
+    useConst(E);
+  // CHECK: :[[@LINE-2]]:13: warning: loop variable 'E' is copied
+
+  for (const Expensive E : V) {
+    Expensive Copy = E;
+    Total += Copy.size();
+  }
+  // CHECK: :[[@LINE-4]]:24: warning: loop variable 'E' is copied
+  return Total;
+}
+
+// CHECK-NOT: warning
+
+template <typename T>
+int templated(std::vector<T> &V) {
+  int Total = 0;
+  for (T E : V)
+    Total += E.size();
+  return Total;
+}
+
+int negative(std::vector<Expensive> &V, std::vector<Cheap> &C) {
+  int Total = templated(V);
+  for (Expensive E : V)
+    E.clear();
+  for (Expensive E : V)
+    useMutable(E);
+  for (Expensive E : V) {
+    Expensive *P = &E;
+    Total += P->size();
+  }
+  for (const Expensive &E : V)
+    Total += E.size();
+  for (Cheap E : C)
+    Total += E.X;
+  return Total;
+}
@@ -0,0 +1,84 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-implicit-conversion-in-loop %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T1, typename T2>
+struct pair {
+  pair(const T1 &, const T2 &);
+  template <typename U1, typename U2>
+  pair(const pair<U1, U2> &);
+  T1 first;
+  T2 second;
+};
+
+struct string {
+  string(const char *);
+  string(const string &);
+  ~string();
+  unsigned size() const;
+};
+
+template <typename K, typename V>
+struct map {
+  typedef pair<const K, V> value_type;
+  value_type *begin() const;
+  value_type *end() const;
+};
+
+template <typename T>
+struct vector {
+  T *begin() const;
+  T *end() const;
+};
+} // namespace std
+
+struct Generator {
+  struct iterator {
+    int operator*() const;
+    iterator &operator++();
+    bool operator!=(const iterator &) const;
+  };
+  iterator begin() const;
+  iterator end() const;
+};
+
+void use(int);
+
+void f(const std::map<std::string, int> &Map, const std::vector<int> &Ints,
+       const Generator &Gen, const std::vector<const char *> &CharPtrs) {
+  for (const std::pair<std::string, int> &P : Map)
+    use(P.second);
+  // CHECK: {{^  for \(const auto &P : Map\)$}}
+  for (const std::pair<std::string, int>& P : Map)
+    use(P.second);
+  // CHECK: {{^  for \(const auto &P : Map\)$}}
+  for (std::pair<std::string, int> &&P : Map)
+    use(P.second);
+  // CHECK: {{^  for \(std::pair<std::string, int> &&P : Map\)$}}
+
+  // Unrelated types aren't fixed: 'const auto &' would be 'const char *'.
+  for (const std::string &S : CharPtrs)
+    use(S.size());
+  // CHECK: {{^  for \(const std::string &S : CharPtrs\)$}}
+
+  // Scalar conversions are left alone.
+  for (const long &L : Ints)
+    use(L);
+  // CHECK: {{^  for \(const long &L : Ints\)$}}
+
+  // The element types match.
+  for (const std::pair<const std::string, int> &P : Map)
+    use(P.second);
+  // CHECK: {{^  for \(const std::pair<const std::string, int> &P : Map\)$}}
+  for (const int &I : Ints)
+    use(I);
+  // CHECK: {{^  for \(const int &I : Ints\)$}}
+  // The iterator yields temporaries.
+  for (const int &I : Gen)
+    use(I);
+  // CHECK: {{^  for \(const int &I : Gen\)$}}
+  // No reference.
+  for (std::pair<std::string, int> P : Map)
+    use(P.second);
+  // CHECK: {{^  for \(std::pair<std::string, int> P : Map\)$}}
+}
@@ -0,0 +1,81 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-ineffective-move %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T> struct remove_reference { typedef T type; };
+template <typename T> struct remove_reference<T &> { typedef T type; };
+template <typename T> struct remove_reference<T &&> { typedef T type; };
+
+template <typename T>
+typename remove_reference<T>::type &&move(T &&Arg) {
+  return static_cast<typename remove_reference<T>::type &&>(Arg);
+}
+} // namespace std
+
+struct Movable {
+  Movable();
+  Movable(const Movable &);
+  Movable(Movable &&);
+  ~Movable();
+};
+
+struct Derived : Movable {};
+
+void sink(int &&);
+void take(Movable);
+
+Movable returnLocal() {
+  Movable M;
+  return std::move(M);
+  // CHECK: {{^  return M;$}}
+}
+
+Movable returnLocalExplicit() {
+  Movable M;
+  return std::move<Movable &>(M);
+  // CHECK: {{^  return M;$}}
+}
+
+Movable returnParam(Movable M) {
+  return std::move(M);
+  // CHECK: {{^  return M;$}}
+}
+
+Movable returnDerived() {
+  Derived D;
+  return std::move(D);
+  // CHECK: {{^  return std::move\(D\);$}}
+}
+
+Movable returnCaught() {
+  try {
+    throw Movable();
+  } catch (Movable E) {
+    return std::move(E);
+    // CHECK: {{^    return std::move\(E\);$}}
+  }
+}
+
+void constAndTrivial(const Movable &C, int I, int *P) {
+  take(std::move(C));
+  // CHECK: {{^  take\(C\);$}}
+  int J = std::move(I);
+  // CHECK: {{^  int J = I;$}}
+  int *Q = std::move(P);
+  // CHECK: {{^  int \*Q = P;$}}
+  sink(std::move(I));
+  // CHECK: {{^  sink\(std::move\(I\)\);$}}
+  Movable M;
+  take(std::move(M));
+  // CHECK: {{^  take\(std::move\(M\)\);$}}
+}
+
+template <typename T>
+T returnTemplate(T X) {
+  int N = std::move(X);
+  return std::move(X);
+}
+// CHECK: {{^  int N = std::move\(X\);$}}
+// CHECK: {{^  return std::move\(X\);$}}
+
+int instantiate() { return returnTemplate(1); }
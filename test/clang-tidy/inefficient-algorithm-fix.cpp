@@ -0,0 +1,105 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-inefficient-algorithm %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+struct less {};
+template <typename T>
+struct equal_to {};
+template <typename T>
+struct hash {};
+template <typename T, typename U>
+struct pair {
+  T first;
+  U second;
+};
+
+template <typename T, typename Compare = less<T> >
+struct set {
+  struct iterator {
+    iterator &operator++();
+    const T &operator*() const;
+    bool operator!=(const iterator &) const;
+  };
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const T &) const;
+  unsigned count(const T &) const;
+  iterator lower_bound(const T &) const;
+  iterator upper_bound(const T &) const;
+};
+
+template <typename T, typename Hash = hash<T>, typename Equal = equal_to<T> >
+struct unordered_set {
+  struct iterator {
+    iterator &operator++();
+    const T &operator*() const;
+    bool operator!=(const iterator &) const;
+  };
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const T &) const;
+  unsigned count(const T &) const;
+};
+
+template <typename K, typename V, typename Compare = less<K> >
+struct map {
+  struct iterator {
+    iterator &operator++();
+    const pair<const K, V> &operator*() const;
+    bool operator!=(const iterator &) const;
+  };
+  iterator begin() const;
+  iterator end() const;
+  iterator find(const K &) const;
+};
+
+template <typename It, typename T>
+It find(It First, It Last, const T &Value);
+template <typename It, typename T>
+int count(It First, It Last, const T &Value);
+template <typename It, typename T>
+It lower_bound(It First, It Last, const T &Value);
+template <typename It, typename T, typename Compare>
+It lower_bound(It First, It Last, const T &Value, Compare Comp);
+} // namespace std
+
+struct Greater {};
+
+struct Index {
+  bool has(int Key) const {
+    return std::count(Keys.begin(), Keys.end(), Key) != 0;
+    // CHECK: {{^    return Keys.count\(Key\) != 0;$}}
+  }
+  std::set<int> Keys;
+};
+
+void f(const std::set<int> &S, const std::set<int> *P,
+       const std::unordered_set<int> &U, const std::set<int, Greater> &G,
+       const std::map<int, int> &M, const std::pair<const int, int> &KV,
+       short Small) {
+  std::find(S.begin(), S.end(), 42);
+  // CHECK: {{^  S.find\(42\);$}}
+  std::lower_bound(P->begin(), P->end(), 42);
+  // CHECK: {{^  P->lower_bound\(42\);$}}
+  std::find(U.begin(), U.end(), 42);
+  // CHECK: {{^  U.find\(42\);$}}
+
+  // Not equivalent: the containers order or compare their keys differently,
+  // the value isn't a key, or unordered containers aren't sorted.
+  std::find(G.begin(), G.end(), 42);
+  // CHECK: {{^  std::find\(G.begin\(\), G.end\(\), 42\);$}}
+  std::find(M.begin(), M.end(), KV);
+  // CHECK: {{^  std::find\(M.begin\(\), M.end\(\), KV\);$}}
+  std::find(S.begin(), S.end(), Small);
+  // CHECK: {{^  std::find\(S.begin\(\), S.end\(\), Small\);$}}
+  std::lower_bound(U.begin(), U.end(), 42);
+  // CHECK: {{^  std::lower_bound\(U.begin\(\), U.end\(\), 42\);$}}
+
+  // Not the full range of one container.
+  std::set<int> T;
+  std::find(S.begin(), T.end(), 42);
+  // CHECK: {{^  std::find\(S.begin\(\), T.end\(\), 42\);$}}
+  std::lower_bound(S.begin(), S.end(), 42, Greater());
+  // CHECK: {{^  std::lower_bound\(S.begin\(\), S.end\(\), 42, Greater\(\)\);$}}
+}
@@ -0,0 +1,34 @@
+// RUN: grep -Ev "// *[A-Z-]+:" %s > %t.cpp
+// RUN: clang-tidy %t.cpp -fix -checks=-*,performance-inefficient-string-concatenation -config="{CheckOptions: [{key: performance-inefficient-string-concatenation.StrictMode, value: 1}]}" -- -std=c++11
+// RUN: FileCheck -input-file=%t.cpp %s -strict-whitespace
+
+namespace std {
+template <typename T>
+class basic_string {
+public:
+  basic_string();
+  basic_string(const basic_string &);
+  ~basic_string();
+  basic_string &operator=(const basic_string &);
+  basic_string &operator+=(const basic_string &);
+};
+template <typename T>
+basic_string<T> operator+(const basic_string<T> &, const basic_string<T> &);
+typedef basic_string<char> string;
+} // namespace std
+
+struct Builder {
+  void add(const std::string &Piece) {
+    Text = Text + Piece;
+    // CHECK: {{^    Text \+= Piece;$}}
+  }
+  std::string Text;
+};
+
+void f(const std::string &A, const std::string &B) {
+  std::string S;
+  S = S + A;
+  // CHECK: {{^  S \+= A;$}}
+  S = S + A + B;
+  // CHECK: {{^  S = S \+ A \+ B;$}}
+}
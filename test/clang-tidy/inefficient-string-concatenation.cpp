@@ -0,0 +1,58 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-inefficient-string-concatenation
+// REQUIRES: shell
+
+// CHECK-NOT: warning
+
+namespace std {
+template <typename T>
+class basic_string {
+public:
+  basic_string();
+  basic_string(const T *);
+  basic_string(const basic_string &);
+  ~basic_string();
+  basic_string &operator=(const basic_string &);
+  basic_string &operator+=(const basic_string &);
+};
+template <typename T>
+basic_string<T> operator+(const basic_string<T> &, const basic_string<T> &);
+template <typename T>
+basic_string<T> operator+(const basic_string<T> &, const T *);
+typedef basic_string<char> string;
+} // namespace std
+
+namespace llvm {
+class Twine {
+public:
+  Twine(const char *);
+  Twine(const std::string &);
+};
+} // namespace llvm
+
+void report(const llvm::Twine &Message);
+
+void positive(const std::string &A, const std::string &B) {
+  std::string Result;
+  for (int I = 0; I < 10; ++I) {
+    Result = Result + A;
+    // CHECK: :[[@LINE-1]]:12: warning: string concatenation results in allocation of unnecessary temporary strings; consider using 'operator+=' or 'string::append()' instead [performance-inefficient-string-concatenation]
+    Result = A + B + "x";
+    // CHECK: :[[@LINE-1]]:12: warning: string concatenation results in allocation
+    report(A + B);
+    // CHECK: :[[@LINE-1]]:14: warning: string concatenation allocates temporary strings only to convert the result to 'llvm::Twine'
+  }
+}
+
+// CHECK-NOT: warning
+
+void negative(const std::string &A, const std::string &B) {
+  std::string Result;
+  Result = Result + A;
+  Result = A + B + "x";
+  report(A + B);
+  for (int I = 0; I < 10; ++I) {
+    Result = A + B;
+    Result += A;
+    report(A);
+  }
+}
@@ -0,0 +1,127 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-inefficient-vector-operation %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+struct vector {
+  vector();
+  vector(const vector &);
+  void push_back(const T &);
+  void reserve(unsigned);
+  unsigned size() const;
+  T *begin() const;
+  T *end() const;
+};
+} // namespace std
+
+namespace llvm {
+template <typename T>
+struct SmallVectorImpl {
+  void push_back(const T &);
+  void reserve(unsigned);
+};
+template <typename T, unsigned N>
+struct SmallVector : SmallVectorImpl<T> {
+  SmallVector();
+};
+} // namespace llvm
+
+void counted(unsigned N) {
+  std::vector<int> V;
+  for (unsigned I = 0; I < N; ++I)
+    V.push_back(I);
+  // CHECK: {{^  V.reserve\(N\);$}}
+  // CHECK-NEXT: {{^  for \(unsigned I = 0; I < N; \+\+I\)$}}
+}
+
+void constantBound() {
+  std::vector<int> V;
+  for (int I = 0; I < 10; ++I)
+    V.push_back(I);
+  // CHECK: {{^  V.reserve\(10\);$}}
+  // CHECK-NEXT: {{^  for \(int I = 0; I < 10; \+\+I\)$}}
+}
+
+void signedBound(int N) {
+  // A negative N doesn't run the loop, but V.reserve(N) would throw.
+  std::vector<int> V;
+  // CHECK: {{^  std::vector<int> V;$}}
+  // CHECK-NEXT: {{^  for \(int I = 0; I < N; \+\+I\)$}}
+  for (int I = 0; I < N; ++I)
+    V.push_back(I);
+}
+
+void rangeBased(const std::vector<int> &Input) {
+  llvm::SmallVector<int, 4> V;
+  for (int X : Input) {
+    V.push_back(X * 2);
+  }
+  // CHECK: {{^  V.reserve\(Input.size\(\)\);$}}
+  // CHECK-NEXT: {{^  for \(int X : Input\) {$}}
+}
+
+void overArray() {
+  int Input[] = {1, 2, 3};
+  std::vector<int> V;
+  for (int X : Input)
+    V.push_back(X);
+  // CHECK: {{^  V.reserve\(3\);$}}
+  // CHECK-NEXT: {{^  for \(int X : Input\)$}}
+}
+
+void boundedBySize(const std::vector<int> &Input) {
+  std::vector<int> V;
+  for (unsigned I = 0; I != Input.size(); I++)
+    V.push_back(I);
+  // CHECK: {{^  V.reserve\(Input.size\(\)\);$}}
+  // CHECK-NEXT: {{^  for \(unsigned I = 0; I != Input.size\(\); I\+\+\)$}}
+}
+
+void negatives(int N, const std::vector<int> &Input) {
+  {
+    // Already reserved.
+    std::vector<int> V;
+    V.reserve(N);
+    for (int I = 0; I < N; ++I)
+      V.push_back(I);
+    // CHECK: {{^    V.reserve\(N\);$}}
+    // CHECK-NEXT: {{^    for \(int I = 0; I < N; \+\+I\)$}}
+  }
+  {
+    // Doesn't start out empty.
+    std::vector<int> V(Input);
+    for (int I = 0; I < N; ++I)
+      V.push_back(I);
+    // CHECK: {{^    std::vector<int> V\(Input\);$}}
+    // CHECK-NEXT: {{^    for \(int I = 0; I < N; \+\+I\)$}}
+  }
+  {
+    // Conditional append.
+    std::vector<int> V;
+    // CHECK: {{^    std::vector<int> V;$}}
+    // CHECK-NEXT: {{^    for \(int I = 0; I < N; \+\+I\)$}}
+    for (int I = 0; I < N; ++I)
+      if (I % 2)
+        V.push_back(I);
+  }
+  {
+    // Counter modified in the body.
+    std::vector<int> V;
+    // CHECK: {{^    std::vector<int> V;$}}
+    // CHECK-NEXT: {{^    for \(int I = 0; I < N; \+\+I\) {$}}
+    for (int I = 0; I < N; ++I) {
+      V.push_back(I);
+      ++I;
+    }
+  }
+  {
+    // Vector used elsewhere in the body.
+    std::vector<int> V;
+    // CHECK: {{^    std::vector<int> V;$}}
+    // CHECK-NEXT: {{^    for \(int I = 0; I < N; \+\+I\) {$}}
+    for (int I = 0; I < N; ++I) {
+      V.push_back(I);
+      N += V.size();
+    }
+  }
+}
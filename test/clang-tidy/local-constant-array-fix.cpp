@@ -0,0 +1,58 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-local-constant-array %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T, unsigned long N>
+struct array {
+  const T &operator[](unsigned long) const;
+  T &operator[](unsigned long);
+  T Elements[N];
+};
+} // namespace std
+
+void use(const int *);
+void modify(int *);
+
+int table(int I) {
+  const int Powers[] = {1, 2, 4, 8};
+  // CHECK: {{^  static const int Powers\[\] = {1, 2, 4, 8};$}}
+  return Powers[I];
+}
+
+const char *name(int I) {
+  const char *Names[] = {"zero", "one"};
+  // CHECK: {{^  static constexpr const char \*Names\[\] = {"zero", "one"};$}}
+  return Names[I];
+}
+
+int mutableButRead(int I) {
+  int Squares[] = {0, 1, 4, 9};
+  // CHECK: {{^  static constexpr int Squares\[\] = {0, 1, 4, 9};$}}
+  use(Squares);
+  int Sum = 0;
+  for (int S : Squares)
+    Sum += S;
+  return Sum + Squares[I] + sizeof(Squares);
+}
+
+int stdArray(int I) {
+  const std::array<int, 3> Primes = {{2, 3, 5}};
+  // CHECK: {{^  static const std::array<int, 3> Primes = }}
+  return Primes[I];
+}
+
+int negatives(int I, int N) {
+  int Written[] = {1, 2};
+  // CHECK: {{^  int Written\[\] = {1, 2};$}}
+  Written[I] = 3;
+  int Passed[] = {1, 2};
+  // CHECK: {{^  int Passed\[\] = {1, 2};$}}
+  modify(Passed);
+  const int Dynamic[] = {N, N + 1};
+  // CHECK: {{^  const int Dynamic\[\] = {N, N \+ 1};$}}
+  std::array<int, 2> NotConst = {{1, 2}};
+  // CHECK: {{^  std::array<int, 2> NotConst = }}
+  static const int AlreadyStatic[] = {1};
+  // CHECK: {{^  static const int AlreadyStatic\[\] = {1};$}}
+  return Written[0] + Passed[0] + Dynamic[I] + NotConst[I] + AlreadyStatic[0];
+}
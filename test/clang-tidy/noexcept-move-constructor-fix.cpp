@@ -0,0 +1,44 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-noexcept-move-constructor %t
+// REQUIRES: shell
+
+void mayThrow();
+void noThrow() noexcept;
+
+struct A {
+  A(A &&) {}
+  // CHECK: {{^  A\(A &&\) noexcept {}$}}
+  A &operator=(A &&);
+  // CHECK: {{^  A &operator=\(A &&\) noexcept;$}}
+  int I;
+};
+
+A &A::operator=(A &&Other) {
+  I = Other.I;
+  noThrow();
+  return *this;
+}
+// CHECK: {{^A &A::operator=\(A &&Other\) noexcept {$}}
+
+struct B {
+  // The body may throw; don't add noexcept.
+  B(B &&) { mayThrow(); }
+  // CHECK: {{^  B\(B &&\) { mayThrow\(\); }$}}
+  B &operator=(B &&) { throw 1; }
+  // CHECK: {{^  B &operator=\(B &&\) { throw 1; }$}}
+};
+
+struct C {
+  C(C &&) noexcept;
+  C &operator=(C &&) = default;
+  C(const C &);
+  // CHECK: {{^  C\(C &&\) noexcept;$}}
+  // CHECK-NEXT: {{^  C &operator=\(C &&\) = default;$}}
+};
+
+struct D {
+  // Declared only; the body can't be analyzed.
+  D(D &&);
+  // CHECK: {{^  D\(D &&\);$}}
+  D &operator=(D &&) noexcept(false);
+  // CHECK: {{^  D &operator=\(D &&\) noexcept\(false\);$}}
+};
@@ -0,0 +1,37 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-noexcept-move-constructor
+// REQUIRES: shell
+
+struct A {
+  A(A &&);
+  // CHECK: :[[@LINE-1]]:3: warning: move constructors should be marked noexcept
+  A &operator=(A &&);
+  // CHECK: :[[@LINE-1]]:6: warning: move assignment operators should be marked noexcept
+};
+
+struct B {
+  static constexpr bool kFalse = false;
+  B(B &&) noexcept(kFalse);
+  // CHECK: :[[@LINE-1]]:20: warning: noexcept specifier on the move constructor evaluates to 'false'
+};
+
+// CHECK-NOT: warning:
+struct OK {
+  OK(OK &&) noexcept;
+  OK &operator=(OK &&) noexcept;
+  OK(const OK &);
+  OK &operator=(const OK &);
+};
+
+struct Deleted {
+  Deleted(Deleted &&) = delete;
+  Deleted &operator=(Deleted &&) = delete;
+};
+
+struct ExplicitlyFalse {
+  ExplicitlyFalse(ExplicitlyFalse &&) noexcept(false);
+};
+
+struct Defaulted {
+  Defaulted(Defaulted &&) = default;
+  Defaulted &operator=(Defaulted &&) = default;
+};
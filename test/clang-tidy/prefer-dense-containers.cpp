@@ -0,0 +1,87 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s llvm-prefer-dense-containers
+// REQUIRES: shell
+
+namespace std {
+template <typename K, typename V>
+struct map {
+  struct iterator {
+    bool operator!=(const iterator &) const;
+    iterator &operator++();
+    int &operator*() const;
+  };
+  iterator begin();
+  iterator end();
+  iterator find(const K &);
+  iterator lower_bound(const K &);
+  V &operator[](const K &);
+};
+template <typename K>
+struct set {
+  struct iterator {
+    bool operator!=(const iterator &) const;
+    iterator &operator++();
+    const K &operator*() const;
+  };
+  iterator begin() const;
+  iterator end() const;
+  void insert(const K &);
+};
+template <typename K, typename V>
+struct unordered_map {
+  V &operator[](const K &);
+};
+template <typename K>
+struct unordered_set {
+  void insert(const K &);
+};
+struct string {};
+} // namespace std
+
+struct Value;
+void print(int);
+
+typedef std::map<Value *, unsigned> NumberingMap;
+// CHECK: :[[@LINE-1]]:37: warning: 'NumberingMap' uses 'std::map' with pointer keys; consider using 'llvm::DenseMap' instead, which doesn't allocate a node per element [llvm-prefer-dense-containers]
+
+typedef std::set<Value *> WorklistSet;
+// CHECK: :[[@LINE-1]]:27: warning: 'WorklistSet' depends on the iteration order of 'std::set', so it isn't suggested to use 'llvm::SmallPtrSet'; consider 'llvm::SetVector' if the insertion order is sufficient [llvm-prefer-dense-containers]
+
+using IndexMap = std::map<unsigned, Value *>;
+// CHECK: :[[@LINE-1]]:7: warning: 'IndexMap' uses 'std::map' with integer keys; consider using 'llvm::DenseMap' instead
+
+struct Function {
+  std::set<Value *> Visited;
+  // CHECK: :[[@LINE-1]]:21: warning: 'Visited' uses 'std::set' with pointer keys; consider using 'llvm::SmallPtrSet' instead
+  std::map<unsigned, int> Ordered;
+  // CHECK: :[[@LINE-1]]:27: warning: 'Ordered' depends on the iteration order of 'std::map', so it isn't suggested to use 'llvm::DenseMap'; consider 'llvm::MapVector' if the insertion order is sufficient [llvm-prefer-dense-containers]
+  NumberingMap Numbers;
+  void dump();
+};
+
+void Function::dump() {
+  for (int V : Ordered)
+    print(V);
+}
+
+void f(Value *V) {
+  std::unordered_map<unsigned, int> Counts;
+  // CHECK: :[[@LINE-1]]:37: warning: 'Counts' uses 'std::unordered_map' with integer keys; consider using 'llvm::DenseMap' instead
+  std::unordered_set<long> Seen;
+  // CHECK: :[[@LINE-1]]:28: warning: 'Seen' uses 'std::unordered_set' with integer keys; consider using 'llvm::DenseSet' instead
+  std::map<int, int> Sorted;
+  // CHECK: :[[@LINE-1]]:22: warning: 'Sorted' depends on the iteration order of 'std::map'
+  Sorted.lower_bound(3);
+  Counts[1]++;
+  Seen.insert(2);
+
+  WorklistSet Worklist;
+  for (Value *W : Worklist)
+    (void)W;
+  IndexMap Indices;
+  Indices[0] = V;
+
+  // CHECK-NOT: warning:
+  std::map<std::string, int> ByName;
+  std::set<bool> Flags;
+  NumberingMap Local;
+}
@@ -0,0 +1,61 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s llvm-prefer-function-ref %t
+// REQUIRES: shell
+
+namespace std {
+template <typename Signature>
+class function;
+template <typename R, typename... Args>
+class function<R(Args...)> {
+public:
+  function();
+  function(const function &);
+  template <typename F>
+  function(F);
+  ~function();
+  R operator()(Args...) const;
+  explicit operator bool() const;
+};
+template <typename T>
+T &&move(T &);
+} // namespace std
+
+struct Node;
+
+void visit(Node *N, const std::function<void(Node *)> &Visitor);
+// CHECK: {{^void visit\(Node \*N, llvm::function_ref<void\(Node \*\)> Visitor\);$}}
+void visit(Node *N, const std::function<void(Node *)> &Visitor) {
+  // CHECK: {{^void visit\(Node \*N, llvm::function_ref<void\(Node \*\)> Visitor\) {$}}
+  for (int I = 0; I < 3; ++I)
+    Visitor(N);
+}
+
+int apply(std::function<int(int)> F, int X) { return F(F(X)); }
+// CHECK: {{^int apply\(llvm::function_ref<int\(int\)> F, int X\) { return F\(F\(X\)\); }$}}
+
+struct Holder {
+  void set(const std::function<void()> &F) { Stored = F; }
+  // CHECK: {{^  void set\(const std::function<void\(\)> &F\) { Stored = F; }$}}
+  void take(std::function<void()> F) { Stored = std::move(F); }
+  // CHECK: {{^  void take\(std::function<void\(\)> F\) { Stored = std::move\(F\); }$}}
+  void check(const std::function<void()> &F) {
+    // CHECK: {{^  void check\(const std::function<void\(\)> &F\) {$}}
+    if (F)
+      F();
+  }
+  virtual void call(const std::function<void()> &F) { F(); }
+  // CHECK: {{^  virtual void call\(const std::function<void\(\)> &F\) { F\(\); }$}}
+  std::function<void()> Stored;
+};
+
+void forward(const std::function<void()> &F) { Holder().check(F); }
+// CHECK: {{^void forward\(const std::function<void\(\)> &F\) { Holder\(\).check\(F\); }$}}
+
+std::function<void()> deferCopy(const std::function<void()> &F) {
+  return [F] { F(); };
+}
+// CHECK: {{^std::function<void\(\)> deferCopy\(const std::function<void\(\)> &F\) {$}}
+
+std::function<void()> deferDefault(const std::function<void()> &F) {
+  return [=] { F(); };
+}
+// CHECK: {{^std::function<void\(\)> deferDefault\(const std::function<void\(\)> &F\) {$}}
@@ -0,0 +1,162 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s llvm-prefer-small-vector %t
+// REQUIRES: shell
+
+namespace std {
+typedef decltype(sizeof(int)) size_t;
+template <typename E>
+class initializer_list {
+  const E *Begin;
+  size_t Size;
+
+public:
+  initializer_list();
+  const E *begin() const;
+  const E *end() const;
+};
+template <typename T>
+class allocator {};
+template <typename T, typename A = allocator<T>>
+class vector {
+public:
+  vector();
+  explicit vector(size_t);
+  vector(initializer_list<T>);
+  vector(const vector &);
+  ~vector();
+  void push_back(const T &);
+  template <typename... Args>
+  void emplace_back(Args &&...);
+  void resize(size_t);
+  size_t size() const;
+  T &operator[](size_t);
+  class iterator {
+  public:
+    T &operator*() const;
+    iterator &operator++();
+    bool operator!=(const iterator &) const;
+  };
+  class const_iterator {
+  public:
+    const_iterator(const iterator &);
+    const T &operator*() const;
+  };
+  iterator begin();
+  iterator end();
+};
+template <typename T>
+T &&move(T &);
+} // namespace std
+
+struct Value;
+Value *getOperand(unsigned);
+void use(const std::vector<Value *> &);
+
+void counted() {
+  std::vector<Value *> Ops;
+  // CHECK: {{^  llvm::SmallVector<Value \*, 3> Ops;$}}
+  for (unsigned I = 0; I != 3; ++I)
+    Ops.push_back(getOperand(I));
+  for (Value *V : Ops)
+    (void)V;
+}
+
+int initialized(bool Flag) {
+  std::vector<int> Numbers = {1, 2, 3};
+  // CHECK: {{^  llvm::SmallVector<int, 5> Numbers = }}
+  if (Flag)
+    Numbers.push_back(4);
+  Numbers.emplace_back(5);
+  return Numbers[0] + Numbers.size();
+}
+
+void nested() {
+  std::vector<int> Grid;
+  // CHECK: {{^  std::vector<int> Grid;$}}
+  for (int I = 0; I < 8; ++I)
+    for (int J = 0; J < 8; ++J)
+      Grid.push_back(I * J);
+}
+
+void rangeOverList() {
+  std::vector<int> Squares;
+  // CHECK: {{^  llvm::SmallVector<int, 4> Squares;$}}
+  for (int X : {1, 2, 3, 4})
+    Squares.push_back(X * X);
+}
+
+template <typename It>
+int sum(It Begin, It End);
+
+void iterators() {
+  std::vector<int> Values = {1, 2};
+  // CHECK: {{^  llvm::SmallVector<int, 2> Values = }}
+  for (auto I = Values.begin(), E = Values.end(); I != E; ++I)
+    (void)*I;
+  sum(Values.begin(), Values.end());
+}
+
+void iteratorType() {
+  // The iterator type would have to be changed as well.
+  std::vector<int> Values = {1, 2};
+  // CHECK: {{^  std::vector<int> Values = }}
+  std::vector<int>::iterator It = Values.begin();
+  (void)*It;
+}
+
+void constIteratorType() {
+  // Converting to the const_iterator spells the type as well.
+  std::vector<int> Values = {1, 2};
+  // CHECK: {{^  std::vector<int> Values = }}
+  std::vector<int>::const_iterator CI = Values.begin();
+  (void)*CI;
+}
+
+void unbounded(int N) {
+  std::vector<int> Values;
+  // CHECK: {{^  std::vector<int> Values;$}}
+  for (int I = 0; I < N; ++I)
+    Values.push_back(I);
+}
+
+void counterModified() {
+  std::vector<int> Values;
+  // CHECK: {{^  std::vector<int> Values;$}}
+  for (int I = 0; I < 2; ++I) {
+    Values.push_back(I);
+    --I;
+  }
+}
+
+void escapes() {
+  std::vector<Value *> Ops;
+  // CHECK: {{^  std::vector<Value \*> Ops;$}}
+  Ops.push_back(getOperand(0));
+  use(Ops);
+}
+
+std::vector<int> returned() {
+  std::vector<int> Result;
+  // CHECK: {{^  std::vector<int> Result;$}}
+  Result.push_back(1);
+  return Result;
+}
+
+void resized() {
+  std::vector<int> Values;
+  // CHECK: {{^  std::vector<int> Values;$}}
+  Values.resize(2);
+  Values.push_back(1);
+}
+
+void inLambda() {
+  std::vector<int> Values;
+  // CHECK: {{^  std::vector<int> Values;$}}
+  auto Add = [&Values]() { Values.push_back(1); };
+  Add();
+}
+
+void empty() {
+  std::vector<int> Values;
+  // CHECK: {{^  std::vector<int> Values;$}}
+  (void)Values.size();
+}
@@ -0,0 +1,84 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-redundant-lookup
+// REQUIRES: shell
+
+namespace std {
+template <typename K, typename V>
+struct map {
+  struct iterator {
+    bool operator!=(const iterator &) const;
+    bool operator==(const iterator &) const;
+  };
+  unsigned count(const K &) const;
+  iterator find(const K &);
+  iterator end();
+  V &operator[](const K &);
+  V &at(const K &);
+  void clear();
+};
+
+template <typename K>
+struct set {
+  struct pair_type {
+    bool second;
+  };
+  unsigned count(const K &) const;
+  pair_type insert(const K &);
+};
+} // namespace std
+
+namespace llvm {
+template <typename K, typename V>
+struct DenseMapBase {
+  unsigned count(const K &) const;
+  V &operator[](const K &);
+  V lookup(const K &) const;
+};
+template <typename K, typename V>
+struct DenseMap : DenseMapBase<K, V> {};
+} // namespace llvm
+
+struct Cache {
+  std::map<int, int> Entries;
+
+  int get(int K) {
+    if (Entries.count(K))
+      return Entries[K];
+    // CHECK: :[[@LINE-1]]:14: warning: the same key is looked up again in the container by 'operator[]' after 'count'; consider saving the iterator returned by 'find' and reusing it
+    // CHECK: :[[@LINE-3]]:9: note: first lookup is here
+    return 0;
+  }
+};
+
+void f(std::map<int, int> &M, std::set<int> &S, llvm::DenseMap<int, int> &D,
+       int K, int V) {
+  if (M.find(K) != M.end())
+    M[K] = V;
+  // CHECK: :[[@LINE-1]]:5: warning: the same key is looked up again in the container by 'operator[]' after 'find'
+  if (!S.count(K))
+    S.insert(K);
+  // CHECK: :[[@LINE-1]]:5: warning: the same key is looked up again in the container by 'insert' after 'count'; consider calling only 'insert' and using the 'bool' member of the pair it returns
+  if (D.count(K))
+    V = D[K];
+  // CHECK: :[[@LINE-1]]:9: warning: the same key is looked up again in the container by 'operator[]' after 'count'; consider using 'lookup' or saving the iterator returned by 'find'
+  if (M.count(K) && M.at(K) > 0)
+    V = 0;
+  // CHECK: :[[@LINE-2]]:21: warning: the same key is looked up again in the container by 'at' after 'count'
+
+  // CHECK-NOT: warning:
+  // Different keys or containers.
+  if (M.count(K))
+    V = M[V];
+  std::map<int, int> M2;
+  if (M.count(K))
+    V = M2[K];
+  // The key is modified in between.
+  if (M.count(K)) {
+    ++K;
+    V = M[K];
+  }
+  // The container is modified in between.
+  if (M.count(K)) {
+    M.clear();
+    V = M[K];
+  }
+}
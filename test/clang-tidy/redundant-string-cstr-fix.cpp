@@ -0,0 +1,75 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-redundant-string-cstr %t
+// REQUIRES: shell
+
+namespace std {
+template <typename T>
+struct allocator {};
+template <typename C, typename A = std::allocator<C> >
+struct basic_string {
+  basic_string();
+  basic_string(const C *, const A & = A());
+  basic_string(const basic_string &);
+  ~basic_string();
+  const C *c_str() const;
+  basic_string &append(const C *);
+  basic_string &append(const basic_string &);
+  basic_string &append(const C *, unsigned long);
+  int compare(const C *) const;
+  int compare(const basic_string &) const;
+};
+typedef basic_string<char> string;
+typedef basic_string<wchar_t> wstring;
+
+template <typename C>
+struct basic_ostream {};
+typedef basic_ostream<char> ostream;
+ostream &operator<<(ostream &, const char *);
+ostream &operator<<(ostream &, const string &);
+} // namespace std
+
+namespace llvm {
+struct StringRef {
+  StringRef(const char *);
+  StringRef(const std::string &);
+};
+struct Twine {
+  Twine(const char *);
+  Twine(const std::string &);
+};
+struct raw_ostream {
+  raw_ostream &operator<<(const char *);
+  raw_ostream &operator<<(const std::string &);
+};
+} // namespace llvm
+
+void takeString(const std::string &);
+void takeStringRef(llvm::StringRef);
+void takeTwine(const llvm::Twine &);
+void takeChars(const char *);
+
+void f(const std::string &S, const std::string *P, std::ostream &OS,
+       llvm::raw_ostream &ROS) {
+  std::string Copy(S.c_str());
+  // CHECK: {{^  std::string Copy\(S\);$}}
+  takeString(P->c_str());
+  // CHECK: {{^  takeString\(\*P\);$}}
+  takeStringRef((&S)->c_str());
+  // CHECK: {{^  takeStringRef\(S\);$}}
+  takeTwine(S.c_str());
+  // CHECK: {{^  takeTwine\(S\);$}}
+  OS << S.c_str();
+  // CHECK: {{^  OS << S;$}}
+  ROS << S.c_str();
+  // CHECK: {{^  ROS << S;$}}
+  Copy.append(S.c_str());
+  // CHECK: {{^  Copy.append\(S\);$}}
+  Copy.compare(P->c_str());
+  // CHECK: {{^  Copy.compare\(\*P\);$}}
+
+  takeChars(S.c_str());
+  // CHECK: {{^  takeChars\(S.c_str\(\)\);$}}
+  Copy.append(S.c_str(), 3);
+  // CHECK: {{^  Copy.append\(S.c_str\(\), 3\);$}}
+  std::wstring Wide;
+  Wide.compare(L"x");
+}
@@ -0,0 +1,64 @@
+// RUN: $(dirname %s)/check_clang_tidy_output.sh %s performance-shared-ptr-param
+// REQUIRES: shell
+
+namespace std {
+typedef decltype(nullptr) nullptr_t;
+
+template <typename T>
+struct shared_ptr {
+  shared_ptr();
+  shared_ptr(const shared_ptr &);
+  ~shared_ptr();
+  shared_ptr &operator=(const shared_ptr &);
+  T &operator*() const;
+  T *operator->() const;
+  T *get() const;
+  explicit operator bool() const;
+  void reset();
+};
+template <typename T>
+bool operator==(const shared_ptr<T> &, nullptr_t);
+
+template <typename T>
+T &&move(T &);
+} // namespace std
+
+struct Buffer {
+  int size() const;
+  void clear();
+};
+
+int size(std::shared_ptr<Buffer> B) { return B->size(); }
+// CHECK: :[[@LINE-1]]:34: warning: parameter 'B' is a 'shared_ptr' passed by value, which updates the reference count on every call, but the function only uses the pointee; consider passing a 'Buffer &' or a 'Buffer *' [performance-shared-ptr-param]
+
+void clear(std::shared_ptr<const Buffer> B, Buffer *Out) {
+// CHECK: :[[@LINE-1]]:42: warning: {{.*}} consider passing a 'const Buffer &' or a 'const Buffer *'
+  *Out = *B;
+}
+
+int sizeOrZero(std::shared_ptr<Buffer> B) {
+// CHECK: :[[@LINE-1]]:40: warning: parameter 'B' is a 'shared_ptr' passed by value, which updates the reference count on every call, but the function doesn't share the ownership; consider passing a 'Buffer *' or a const reference to the 'shared_ptr' [performance-shared-ptr-param]
+  if (!B || B == nullptr)
+    return 0;
+  return B.get()->size();
+}
+
+// CHECK-NOT: warning:
+struct Holder {
+  void set(std::shared_ptr<Buffer> B) { Stored = B; }
+  void take(std::shared_ptr<Buffer> B) { Stored = std::move(B); }
+  void drop(std::shared_ptr<Buffer> B) { B.reset(); }
+  virtual int size(std::shared_ptr<Buffer> B) { return B->size(); }
+  std::shared_ptr<Buffer> Stored;
+};
+
+int capture(std::shared_ptr<Buffer> B) {
+  auto Size = [=] { return B->size(); };
+  return Size();
+}
+
+std::shared_ptr<Buffer> identity(std::shared_ptr<Buffer> B) { return B; }
+
+void unused(std::shared_ptr<Buffer> B) {}
+
+int byReference(const std::shared_ptr<Buffer> &B) { return B->size(); }
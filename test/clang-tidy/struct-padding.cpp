@@ -0,0 +1,94 @@
+// RUN: clang-tidy -checks=-*,performance-struct-padding %s -- -std=c++11 -target x86_64-unknown-unknown | FileCheck %s
+// RUN: clang-tidy -checks=-*,performance-struct-padding -config="{CheckOptions: [{key: performance-struct-padding.Threshold, value: 8}]}" %s -- -std=c++11 -target x86_64-unknown-unknown | FileCheck -check-prefix=THRESHOLD %s
+
+struct Padded {
+  char A;
+  double B;
+  char C;
+};
+// CHECK: :[[@LINE-5]]:8: warning: 'Padded' is 24 bytes but would be 16 bytes if its fields were reordered to minimize padding (saving 8 bytes); consider the order: B, A, C [performance-struct-padding]
+// THRESHOLD-NOT: warning: 'Padded'
+
+class Slightly {
+  char A;
+  int B;
+  char C;
+  short D;
+};
+// CHECK: :[[@LINE-6]]:7: warning: 'Slightly' is 12 bytes but would be 8 bytes if its fields were reordered to minimize padding (saving 4 bytes); consider the order: B, D, A, C [performance-struct-padding]
+
+struct Large {
+  bool Flag;
+  void *Data[4];
+  bool Other;
+  long Count;
+  bool Last;
+};
+// CHECK: :[[@LINE-7]]:8: warning: 'Large' is 64 bytes but would be 48 bytes if its fields were reordered to minimize padding (saving 16 bytes); consider the order: Data, Count, Flag, Other, Last [performance-struct-padding]
+// THRESHOLD: :[[@LINE-8]]:8: warning: 'Large' is 64 bytes
+
+// CHECK-NOT: warning:
+// THRESHOLD-NOT: warning:
+struct Optimal {
+  double B;
+  char A;
+  char C;
+};
+
+struct BitFields {
+  char A;
+  int B : 3;
+  char C;
+  int D;
+};
+
+struct __attribute__((packed)) Packed {
+  char A;
+  int B;
+  char C;
+};
+
+#pragma pack(push, 2)
+struct PragmaPacked {
+  char A;
+  int B;
+  char C;
+};
+#pragma pack(pop)
+
+extern "C" {
+struct SharedWithC {
+  char A;
+  int B;
+  char C;
+};
+}
+
+struct Base {
+  int X;
+};
+struct Derived : Base {
+  char A;
+  int B;
+  char C;
+};
+
+struct Virtual {
+  virtual ~Virtual();
+  char A;
+  int B;
+  char C;
+};
+
+union U {
+  char A;
+  int B;
+};
+
+template <typename T>
+struct Template {
+  char A;
+  T B;
+  char C;
+};
+Template<int> Instance;
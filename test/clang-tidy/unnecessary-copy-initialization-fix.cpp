@@ -0,0 +1,105 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-unnecessary-copy-initialization %t
+// REQUIRES: shell
+
+namespace std {
+struct string {
+  string();
+  string(const char *);
+  string(const string &);
+  ~string();
+  unsigned size() const;
+  void clear();
+};
+} // namespace std
+
+struct Config {
+  const std::string &getName() const;
+  std::string getValue() const;
+  std::string &mutableName();
+  void setName(const std::string &);
+};
+
+const std::string &globalName();
+void consume(const std::string &);
+void mutate(std::string &);
+
+void positive(const Config &C, Config &Mutable) {
+  const std::string Name = C.getName();
+  // CHECK: {{^  const std::string &Name = C.getName\(\);$}}
+  consume(Name);
+
+  std::string Global = globalName();
+  // CHECK: {{^  const std::string &Global = globalName\(\);$}}
+  unsigned N = Global.size();
+
+  const auto Local = Name;
+  // CHECK: {{^  const auto &Local = Name;$}}
+  consume(Local);
+
+  const std::string FromMutable = Mutable.getName();
+  // CHECK: {{^  const std::string &FromMutable = Mutable.getName\(\);$}}
+  consume(FromMutable);
+}
+
+struct Holder {
+  void method();
+  Config Member;
+};
+
+Config GlobalConfig;
+
+void Holder::method() {
+  const std::string FromMember = Member.getName();
+  // CHECK: {{^  const std::string FromMember = Member.getName\(\);$}}
+  Member.setName("x");
+  consume(FromMember);
+
+  const std::string FromGlobal = GlobalConfig.getName();
+  // CHECK: {{^  const std::string FromGlobal = GlobalConfig.getName\(\);$}}
+  consume(FromGlobal);
+}
+
+struct Widget : Config {
+  void rename() {
+    const std::string OldName = this->getName();
+    // CHECK: {{^    const std::string OldName = this->getName\(\);$}}
+    setName("x");
+    consume(OldName);
+  }
+};
+
+void negative(Config &C) {
+  std::string Modified = C.getName();
+  // CHECK: {{^  std::string Modified = C.getName\(\);$}}
+  Modified.clear();
+
+  const std::string ByValue = C.getValue();
+  // CHECK: {{^  const std::string ByValue = C.getValue\(\);$}}
+  consume(ByValue);
+
+  const std::string FromNonConst = C.mutableName();
+  // CHECK: {{^  const std::string FromNonConst = C.mutableName\(\);$}}
+  consume(FromNonConst);
+
+  Config *Pointer = &C;
+  const std::string ThroughPointer = Pointer->getName();
+  // CHECK: {{^  const std::string ThroughPointer = Pointer->getName\(\);$}}
+  Pointer->setName("x");
+  consume(ThroughPointer);
+
+  const std::string BeforeSet = C.getName();
+  // CHECK: {{^  const std::string BeforeSet = C.getName\(\);$}}
+  C.setName("x");
+  consume(BeforeSet);
+
+  std::string Source;
+  const std::string CopyOfModified = Source;
+  // CHECK: {{^  const std::string CopyOfModified = Source;$}}
+  mutate(Source);
+  consume(CopyOfModified);
+
+  std::string A = C.getName(), B = C.getName();
+  // CHECK: {{^  std::string A = C.getName\(\), B = C.getName\(\);$}}
+  consume(A);
+  consume(B);
+}
@@ -0,0 +1,52 @@
+// RUN: $(dirname %s)/check_clang_tidy_fix.sh %s performance-unnecessary-value-param %t
+// REQUIRES: shell
+
+namespace std {
+struct string {
+  string(const string &);
+  ~string();
+  unsigned size() const;
+  void clear();
+};
+template <typename T> T &&move(T &);
+} // namespace std
+
+struct Large {
+  char Data[128];
+};
+
+struct Small {
+  int X;
+};
+
+unsigned declaredFirst(std::string S);
+// CHECK: {{^unsigned declaredFirst\(const std::string &S\);$}}
+unsigned declaredFirst(std::string S) { return S.size(); }
+// CHECK: {{^unsigned declaredFirst\(const std::string &S\) { return S.size\(\); }$}}
+
+unsigned unnamedDecl(std::string);
+// CHECK: {{^unsigned unnamedDecl\(const std::string &\);$}}
+unsigned unnamedDecl(std::string S) { return S.size(); }
+// CHECK: {{^unsigned unnamedDecl\(const std::string &S\) { return S.size\(\); }$}}
+
+int large(Large L) { return L.Data[0]; }
+// CHECK: {{^int large\(const Large &L\) { return L.Data\[0\]; }$}}
+
+int small(Small S) { return S.X; }
+// CHECK: {{^int small\(Small S\) { return S.X; }$}}
+
+void modified(std::string S) { S.clear(); }
+// CHECK: {{^void modified\(std::string S\) { S.clear\(\); }$}}
+
+std::string moved(std::string S) { return std::move(S); }
+// CHECK: {{^std::string moved\(std::string S\) { return std::move\(S\); }$}}
+
+struct Holder {
+  Holder(std::string S) : Member(S) {}
+  // CHECK: {{^  Holder\(const std::string &S\) : Member\(S\) {}$}}
+  Holder(std::string S, int) : Member(std::move(S)) {}
+  // CHECK: {{^  Holder\(std::string S, int\) : Member\(std::move\(S\)\) {}$}}
+  virtual unsigned size(std::string S) { return S.size(); }
+  // CHECK: {{^  virtual unsigned size\(std::string S\) { return S.size\(\); }$}}
+  std::string Member;
+};
@@ -0,0 +1,15 @@
+// RUN: clang-tidy -checks=-*,performance-unnecessary-value-param -config="{CheckOptions: [{key: performance-unnecessary-value-param.SizeThreshold, value: 8}]}" %s -- -std=c++11 | FileCheck %s
+
+struct Medium {
+  int A, B, C, D;
+};
+
+struct Tiny {
+  int A;
+};
+
+int medium(Medium M) { return M.A; }
+// CHECK: :[[@LINE-1]]:19: warning: parameter 'M' is passed by value and copied on every call, but only read; consider passing it as a const reference [performance-unnecessary-value-param]
+
+// CHECK-NOT: warning:
+int tiny(Tiny T) { return T.A; }
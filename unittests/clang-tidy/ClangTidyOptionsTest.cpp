@@ -66,6 +66,20 @@ TEST(ParseConfiguration, ValidConfiguration) {
   EXPECT_TRUE(Options.AnalyzeTemporaryDtors);
 }
 
+TEST(ParseConfiguration, CheckOptions) {
+  ClangTidyOptions Options;
+  std::error_code Error = parseConfiguration(
+      "{CheckOptions: [{key: \"check-a.Option\", value: \"16\"},"
+      "{key: \"check-b.Option\", value: \"x\"}]}",
+      Options);
+  EXPECT_FALSE(Error);
+  EXPECT_EQ(2u, Options.CheckOptions.size());
+  EXPECT_EQ("16", Options.CheckOptions["check-a.Option"]);
+  EXPECT_EQ("x", Options.CheckOptions["check-b.Option"]);
+
+  EXPECT_TRUE(!!parseConfiguration("{CheckOptions: [{key: \"a\"}]}", Options));
+}
+
 } // namespace test
 } // namespace tidy
 } // namespace clang
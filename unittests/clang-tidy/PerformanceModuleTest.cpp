@@ -0,0 +1,65 @@
+#include "ClangTidyTest.h"
+#include "performance/ForRangeCopyCheck.h"
+#include "gtest/gtest.h"
+
+namespace clang {
+namespace tidy {
+namespace test {
+
+using performance::ForRangeCopyCheck;
+
+#define EXPECT_NO_CHANGES(Check, Code)                                         \
+  EXPECT_EQ(Code, runCheckOnCode<Check>(Code))
+
+static const char ExpensiveDecls[] =
+    "struct S { S(); S(const S &); ~S(); int get() const; void set(int); };\n"
+    "struct V { S *begin(); S *end(); };\n";
+
+TEST(ForRangeCopyCheckTest, CopyOnlyRead) {
+  EXPECT_EQ(std::string(ExpensiveDecls) +
+                "int f(V &v) { int n = 0; for (const S &s : v) n += s.get(); "
+                "return n; }",
+            runCheckOnCode<ForRangeCopyCheck>(
+                std::string(ExpensiveDecls) +
+                "int f(V &v) { int n = 0; for (S s : v) n += s.get(); "
+                "return n; }"));
+  EXPECT_EQ(std::string(ExpensiveDecls) +
+                "void g(const S &);"
+                "void f(V &v) { for (const auto &s : v) g(s); }",
+            runCheckOnCode<ForRangeCopyCheck>(
+                std::string(ExpensiveDecls) +
+                "void g(const S &);"
+                "void f(V &v) { for (auto s : v) g(s); }"));
+  EXPECT_EQ(std::string(ExpensiveDecls) +
+                "void f(V &v) { for (const S &s : v) s.get(); }",
+            runCheckOnCode<ForRangeCopyCheck>(
+                std::string(ExpensiveDecls) +
+                "void f(V &v) { for (const S s : v) s.get(); }"));
+}
+
+TEST(ForRangeCopyCheckTest, CopyModified) {
+  EXPECT_NO_CHANGES(ForRangeCopyCheck,
+                    std::string(ExpensiveDecls) +
+                        "void f(V &v) { for (S s : v) s.set(1); }");
+  EXPECT_NO_CHANGES(ForRangeCopyCheck,
+                    std::string(ExpensiveDecls) +
+                        "void g(S &);"
+                        "void f(V &v) { for (S s : v) g(s); }");
+  EXPECT_NO_CHANGES(ForRangeCopyCheck,
+                    std::string(ExpensiveDecls) +
+                        "void f(V &v) { for (S s : v) { S *p = &s; } }");
+}
+
+TEST(ForRangeCopyCheckTest, CheapOrAlreadyReference) {
+  EXPECT_NO_CHANGES(ForRangeCopyCheck,
+                    "struct P { int x, y; }; struct V { P *begin(); P *end(); };"
+                    "int f(V &v) { int n = 0; for (P p : v) n += p.x; "
+                    "return n; }");
+  EXPECT_NO_CHANGES(ForRangeCopyCheck,
+                    std::string(ExpensiveDecls) +
+                        "void f(V &v) { for (const S &s : v) s.get(); }");
+}
+
+} // namespace test
+} // namespace tidy
+} // namespace clang